@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California,
  *                           Arizona Board of Regents.
  *
@@ -23,6 +23,8 @@
 #include "logger.hpp"
 
 #include <algorithm>
+#include <iterator>
+#include <set>
 
 namespace nlsr {
 
@@ -31,14 +33,37 @@ INIT_LOGGER(AdjacencyList);
 bool
 AdjacencyList::insert(const Adjacent& adjacent)
 {
-  auto it = find(adjacent.getName());
-  if (it != m_adjList.end()) {
+  size_t index = m_adjList.size();
+  if (!m_nameIndex.try_emplace(adjacent.getName(), index).second) {
     return false;
   }
+  // Lookups by FaceUri and FaceId find the first adjacency that matches
+  m_faceUriIndex.try_emplace(adjacent.getFaceUri().toString(), index);
+  m_faceIdIndex.try_emplace(adjacent.getFaceId(), index);
   m_adjList.push_back(adjacent);
   return true;
 }
 
+void
+AdjacencyList::erase(const_iterator it)
+{
+  m_adjList.erase(it);
+  rebuildIndexes();
+}
+
+void
+AdjacencyList::rebuildIndexes()
+{
+  m_nameIndex.clear();
+  m_faceUriIndex.clear();
+  m_faceIdIndex.clear();
+  for (size_t i = 0; i < m_adjList.size(); ++i) {
+    m_nameIndex.try_emplace(m_adjList[i].getName(), i);
+    m_faceUriIndex.try_emplace(m_adjList[i].getFaceUri().toString(), i);
+    m_faceIdIndex.try_emplace(m_adjList[i].getFaceId(), i);
+  }
+}
+
 Adjacent
 AdjacencyList::getAdjacent(const ndn::Name& adjName) const
 {
@@ -53,7 +78,7 @@ AdjacencyList::getAdjacent(const ndn::Name& adjName) const
 bool
 AdjacencyList::operator==(const AdjacencyList& adl) const
 {
-  auto theirList = adl.getAdjList();
+  const auto& theirList = adl.getAdjList();
   if (m_adjList.size() != theirList.size()) {
     return false;
   }
@@ -118,13 +143,7 @@ AdjacencyList::setStatusOfNeighbor(const ndn::Name& neighbor, Adjacent::Status s
   }
 }
 
-std::list<Adjacent>&
-AdjacencyList::getAdjList()
-{
-  return m_adjList;
-}
-
-const std::list<Adjacent>&
+const std::vector<Adjacent>&
 AdjacencyList::getAdjList() const
 {
   return m_adjList;
@@ -159,46 +178,57 @@ AdjacencyList::getNumOfActiveNeighbor() const
   return actNbrCount;
 }
 
-std::list<Adjacent>::iterator
+AdjacencyList::iterator
 AdjacencyList::find(const ndn::Name& adjName)
 {
-  return std::find_if(m_adjList.begin(), m_adjList.end(),
-                      std::bind(&Adjacent::compare, _1, std::cref(adjName)));
+  auto it = m_nameIndex.find(adjName);
+  return it != m_nameIndex.end() ? m_adjList.begin() + it->second : m_adjList.end();
 }
 
-std::list<Adjacent>::const_iterator
+AdjacencyList::const_iterator
 AdjacencyList::find(const ndn::Name& adjName) const
 {
-  return std::find_if(m_adjList.cbegin(), m_adjList.cend(),
-                      std::bind(&Adjacent::compare, _1, std::cref(adjName)));
+  auto it = m_nameIndex.find(adjName);
+  return it != m_nameIndex.end() ? m_adjList.begin() + it->second : m_adjList.end();
 }
 
 AdjacencyList::iterator
 AdjacencyList::findAdjacent(const ndn::Name& adjName)
 {
-  return std::find_if(m_adjList.begin(), m_adjList.end(),
-                      std::bind(&Adjacent::compare, _1, std::cref(adjName)));
+  return find(adjName);
 }
 
 AdjacencyList::iterator
 AdjacencyList::findAdjacent(uint64_t faceId)
 {
-  return std::find_if(m_adjList.begin(), m_adjList.end(),
-                      std::bind(&Adjacent::compareFaceId, _1, faceId));
+  auto indexIt = m_faceIdIndex.find(faceId);
+  if (indexIt != m_faceIdIndex.end() && m_adjList[indexIt->second].getFaceId() == faceId) {
+    return m_adjList.begin() + indexIt->second;
+  }
+
+  // The FaceId was changed since it was indexed
+  auto it = std::find_if(m_adjList.begin(), m_adjList.end(),
+                         std::bind(&Adjacent::compareFaceId, _1, faceId));
+  if (it != m_adjList.end()) {
+    m_faceIdIndex[faceId] = std::distance(m_adjList.begin(), it);
+  }
+  else if (indexIt != m_faceIdIndex.end()) {
+    m_faceIdIndex.erase(indexIt);
+  }
+  return it;
 }
 
 AdjacencyList::iterator
 AdjacencyList::findAdjacent(const ndn::FaceUri& faceUri)
 {
-  return std::find_if(m_adjList.begin(), m_adjList.end(),
-                      std::bind(&Adjacent::compareFaceUri, _1, faceUri));
+  auto it = m_faceUriIndex.find(faceUri.toString());
+  return it != m_faceUriIndex.end() ? m_adjList.begin() + it->second : m_adjList.end();
 }
 
 uint64_t
 AdjacencyList::getFaceId(const ndn::FaceUri& faceUri)
 {
-  auto it = std::find_if(m_adjList.begin(), m_adjList.end(),
-                         std::bind(&Adjacent::compareFaceUri, _1, faceUri));
+  auto it = findAdjacent(faceUri);
   return it != m_adjList.end() ? it->getFaceId() : 0;
 }
 
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California,
  *                           Arizona Board of Regents.
  *
@@ -25,23 +25,37 @@
 #include "adjacent.hpp"
 #include "common.hpp"
 
-#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace nlsr {
 
+/**
+ * @brief List of the adjacencies of a router, in the order they were inserted.
+ *
+ * Adjacencies are looked up by name and FaceUri through hash indexes, so the name and FaceUri
+ * of an inserted adjacency must not be changed. Its FaceId may be changed through an iterator;
+ * the FaceId index is corrected when a lookup finds it out of date.
+ */
 class AdjacencyList
 {
 public:
-  using const_iterator = std::list<Adjacent>::const_iterator;
-  using iterator = std::list<Adjacent>::iterator;
+  using const_iterator = std::vector<Adjacent>::const_iterator;
+  using iterator = std::vector<Adjacent>::iterator;
 
   bool
   insert(const Adjacent& adjacent);
 
-  std::list<Adjacent>&
-  getAdjList();
+  /**
+   * @brief Remove an adjacency.
+   *
+   * Iterators to the adjacencies after @p it are invalidated.
+   */
+  void
+  erase(const_iterator it);
 
-  const std::list<Adjacent>&
+  const std::vector<Adjacent>&
   getAdjList() const;
 
   bool
@@ -99,6 +113,9 @@ public:
   reset()
   {
     m_adjList.clear();
+    m_nameIndex.clear();
+    m_faceUriIndex.clear();
+    m_faceIdIndex.clear();
   }
 
   AdjacencyList::iterator
@@ -117,6 +134,18 @@ public:
   writeLog();
 
 public:
+  iterator
+  begin()
+  {
+    return m_adjList.begin();
+  }
+
+  iterator
+  end()
+  {
+    return m_adjList.end();
+  }
+
   const_iterator
   begin() const
   {
@@ -136,8 +165,15 @@ private:
   const_iterator
   find(const ndn::Name& adjName) const;
 
+  void
+  rebuildIndexes();
+
 private:
-  std::list<Adjacent> m_adjList;
+  std::vector<Adjacent> m_adjList;
+  std::unordered_map<ndn::Name, size_t> m_nameIndex;
+  std::unordered_map<std::string, size_t> m_faceUriIndex;
+  /// May be out of date, as FaceIds are changed through iterators.
+  std::unordered_map<uint64_t, size_t> m_faceIdIndex;
 };
 
 } // namespace nlsr
@@ -37,6 +37,7 @@ SyncLogicHandler::SyncLogicHandler(ndn::Face& face, ndn::KeyChain& keyChain,
   , m_nameLsaUserPrefix(makeLsaUserPrefix(opts.userPrefix, Lsa::Type::NAME))
   , m_adjLsaUserPrefix(makeLsaUserPrefix(opts.userPrefix, Lsa::Type::ADJACENCY))
   , m_coorLsaUserPrefix(makeLsaUserPrefix(opts.userPrefix, Lsa::Type::COORDINATE))
+  , m_userPrefix(opts.userPrefix)
   , m_syncLogic(face, keyChain, opts.syncProtocol, opts.syncPrefix,
                 m_nameLsaUserPrefix, opts.syncInterestLifetime,
                 std::bind(&SyncLogicHandler::processUpdate, this, _1, _2, _3))
@@ -48,6 +49,21 @@ SyncLogicHandler::SyncLogicHandler(ndn::Face& face, ndn::KeyChain& keyChain,
   if (m_hyperbolicState != HYPERBOLIC_STATE_OFF) {
     m_syncLogic.addUserNode(m_coorLsaUserPrefix);
   }
+
+  for (uint32_t shard = 1; shard < opts.nNameLsaShards; ++shard) {
+    addNameLsaShardNode(shard);
+  }
+}
+
+const ndn::Name&
+SyncLogicHandler::addNameLsaShardNode(uint32_t shard)
+{
+  auto [it, isNew] = m_nameLsaShardUserPrefixes.try_emplace(shard);
+  if (isNew) {
+    it->second = makeLsaUserPrefix(m_userPrefix, Lsa::Type::NAME, shard);
+    m_syncLogic.addUserNode(it->second);
+  }
+  return it->second;
 }
 
 void
@@ -72,7 +88,7 @@ SyncLogicHandler::processUpdate(const ndn::Name& updateName, uint64_t highSeq, u
 }
 
 void
-SyncLogicHandler::publishRoutingUpdate(Lsa::Type type, uint64_t seqNo)
+SyncLogicHandler::publishRoutingUpdate(Lsa::Type type, uint64_t seqNo, uint32_t shard)
 {
   switch (type) {
   case Lsa::Type::ADJACENCY:
@@ -82,7 +98,9 @@ SyncLogicHandler::publishRoutingUpdate(Lsa::Type type, uint64_t seqNo)
     m_syncLogic.publishUpdate(m_coorLsaUserPrefix, seqNo);
     break;
   case Lsa::Type::NAME:
-    m_syncLogic.publishUpdate(m_nameLsaUserPrefix, seqNo);
+    // Shards left over from a larger shard count are also published, to withdraw them
+    m_syncLogic.publishUpdate(shard == 0 ? m_nameLsaUserPrefix : addNameLsaShardNode(shard),
+                              seqNo);
     break;
   default:
     break;
@@ -30,6 +30,8 @@
 
 #include <boost/lexical_cast.hpp>
 
+#include <map>
+
 namespace nlsr {
 
 struct SyncLogicOptions
@@ -40,12 +42,14 @@ struct SyncLogicOptions
   ndn::time::milliseconds syncInterestLifetime;
   ndn::Name routerPrefix;
   HyperbolicState hyperbolicState;
+  /// Number of shards the own Name LSA is split into; each shard is a separate sync node.
+  uint32_t nNameLsaShards = 1;
 };
 
 inline ndn::Name
-makeLsaUserPrefix(const ndn::Name& userPrefix, Lsa::Type lsaType)
+makeLsaUserPrefix(const ndn::Name& userPrefix, Lsa::Type lsaType, uint32_t shard = 0)
 {
-  return ndn::Name(userPrefix).append(boost::lexical_cast<std::string>(lsaType));
+  return ndn::Name(userPrefix).append(makeLsaTypeComponent(lsaType, shard));
 }
 
 /*! \brief NLSR-to-sync interaction point
@@ -75,7 +79,7 @@ public:
    * \sa publishSyncUpdate
    */
   void
-  publishRoutingUpdate(Lsa::Type type, uint64_t seqNo);
+  publishRoutingUpdate(Lsa::Type type, uint64_t seqNo, uint32_t shard = 0);
 
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   /*! \brief Callback from Sync protocol
@@ -87,6 +91,11 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   void
   processUpdate(const ndn::Name& updateName, uint64_t highSeq, uint64_t incomingFaceId);
 
+  /*! \brief Returns the user prefix of a Name LSA shard, adding its sync node if needed.
+   */
+  const ndn::Name&
+  addNameLsaShardNode(uint32_t shard);
+
 public:
   OnSyncUpdate onSyncUpdate;
 
@@ -98,6 +107,9 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   ndn::Name m_nameLsaUserPrefix;
   ndn::Name m_adjLsaUserPrefix;
   ndn::Name m_coorLsaUserPrefix;
+  /// User prefixes of the Name LSA shards other than shard 0.
+  std::map<uint32_t, ndn::Name> m_nameLsaShardUserPrefixes;
+  ndn::Name m_userPrefix;
 
   SyncProtocolAdapter m_syncLogic;
 };
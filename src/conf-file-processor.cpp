@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California,
  *                           Arizona Board of Regents.
  *
@@ -331,6 +331,58 @@ ConfFileProcessor::processConfSectionGeneral(const ConfigSection& section)
     return false;
   }
 
+  // signing-threads
+  ConfigurationVariable<uint32_t> signingThreads("signing-threads",
+                                                 std::bind(&ConfParameter::setSigningThreads,
+                                                 &m_confParam, _1));
+  signingThreads.setMinAndMaxValue(SIGNING_THREADS_MIN, SIGNING_THREADS_MAX);
+  signingThreads.setOptional(SIGNING_THREADS_DEFAULT);
+
+  if (!signingThreads.parseFromConfigSection(section)) {
+    return false;
+  }
+
+  // name-lsa-delta
+  std::string nameLsaDelta = section.get<std::string>("name-lsa-delta", "off");
+
+  if (boost::iequals(nameLsaDelta, "on")) {
+    m_confParam.setNameLsaDelta(true);
+  }
+  else if (boost::iequals(nameLsaDelta, "off")) {
+    m_confParam.setNameLsaDelta(false);
+  }
+  else {
+    std::cerr << "Invalid value for name-lsa-delta. "
+              << "Allowed values: on, off" << std::endl;
+    return false;
+  }
+
+  // name-lsa-shards
+  ConfigurationVariable<uint32_t> nameLsaShards("name-lsa-shards",
+                                                std::bind(&ConfParameter::setNameLsaShards,
+                                                &m_confParam, _1));
+  nameLsaShards.setMinAndMaxValue(NAME_LSA_SHARDS_MIN, NAME_LSA_SHARDS_MAX);
+  nameLsaShards.setOptional(NAME_LSA_SHARDS_DEFAULT);
+
+  if (!nameLsaShards.parseFromConfigSection(section)) {
+    return false;
+  }
+
+  // name-lsa-compact
+  std::string nameLsaCompact = section.get<std::string>("name-lsa-compact", "off");
+
+  if (boost::iequals(nameLsaCompact, "on")) {
+    m_confParam.setNameLsaCompact(true);
+  }
+  else if (boost::iequals(nameLsaCompact, "off")) {
+    m_confParam.setNameLsaCompact(false);
+  }
+  else {
+    std::cerr << "Invalid value for name-lsa-compact. "
+              << "Allowed values: on, off" << std::endl;
+    return false;
+  }
+
   // state-dir
   try {
     fs::path stateDir(section.get<std::string>("state-dir"));
@@ -438,6 +490,51 @@ ConfFileProcessor::processConfSectionNeighbors(const ConfigSection& section)
   if (!adjLsaBuildInterval.parseFromConfigSection(section)) {
     return false;
   }
+
+  // adj-lsa-throttle
+  std::string adjLsaThrottle = section.get<std::string>("adj-lsa-throttle", "off");
+
+  if (boost::iequals(adjLsaThrottle, "on")) {
+    m_confParam.setAdjLsaThrottle(true);
+  }
+  else if (boost::iequals(adjLsaThrottle, "off")) {
+    m_confParam.setAdjLsaThrottle(false);
+  }
+  else {
+    std::cerr << "Invalid value for adj-lsa-throttle. "
+              << "Allowed values: on, off" << std::endl;
+    return false;
+  }
+
+  // adj-lsa-hold-down-min
+  ConfigurationVariable<uint32_t> adjLsaHoldDownMin("adj-lsa-hold-down-min",
+                                                    std::bind(&ConfParameter::setAdjLsaHoldDownMin,
+                                                    &m_confParam, _1));
+  adjLsaHoldDownMin.setMinAndMaxValue(ADJ_LSA_HOLD_DOWN_MIN_MIN, ADJ_LSA_HOLD_DOWN_MIN_MAX);
+  adjLsaHoldDownMin.setOptional(ADJ_LSA_HOLD_DOWN_MIN_DEFAULT);
+
+  if (!adjLsaHoldDownMin.parseFromConfigSection(section)) {
+    return false;
+  }
+
+  // adj-lsa-hold-down-max
+  ConfigurationVariable<uint32_t> adjLsaHoldDownMax("adj-lsa-hold-down-max",
+                                                    std::bind(&ConfParameter::setAdjLsaHoldDownMax,
+                                                    &m_confParam, _1));
+  adjLsaHoldDownMax.setMinAndMaxValue(ADJ_LSA_HOLD_DOWN_MAX_MIN, ADJ_LSA_HOLD_DOWN_MAX_MAX);
+  adjLsaHoldDownMax.setOptional(ADJ_LSA_HOLD_DOWN_MAX_DEFAULT);
+
+  if (!adjLsaHoldDownMax.parseFromConfigSection(section)) {
+    return false;
+  }
+
+  // The hold-down is only used, and thus only checked, when the throttle is enabled
+  if (m_confParam.isAdjLsaThrottleEnabled() &&
+      m_confParam.getAdjLsaHoldDownMin() > m_confParam.getAdjLsaHoldDownMax()) {
+    std::cerr << "adj-lsa-hold-down-min must not exceed adj-lsa-hold-down-max" << std::endl;
+    return false;
+  }
+
   // Set the retry count for fetching the FaceStatus dataset
   ConfigurationVariable<uint32_t> faceDatasetFetchTries("face-dataset-fetch-tries",
                                                         std::bind(&ConfParameter::setFaceDatasetFetchTries,
@@ -599,6 +696,129 @@ ConfFileProcessor::processConfSectionFib(const ConfigSection& section)
     return false;
   }
 
+  // spf-throttle
+  std::string spfThrottle = section.get<std::string>("spf-throttle", "off");
+
+  if (boost::iequals(spfThrottle, "on")) {
+    m_confParam.setSpfThrottle(true);
+  }
+  else if (boost::iequals(spfThrottle, "off")) {
+    m_confParam.setSpfThrottle(false);
+  }
+  else {
+    std::cerr << "Invalid value for spf-throttle. "
+              << "Allowed values: on, off" << std::endl;
+    return false;
+  }
+
+  // spf-initial-wait
+  ConfigurationVariable<uint32_t> spfInitialWait("spf-initial-wait",
+                                                 std::bind(&ConfParameter::setSpfInitialWait,
+                                                 &m_confParam, _1));
+  spfInitialWait.setMinAndMaxValue(SPF_INITIAL_WAIT_MIN, SPF_INITIAL_WAIT_MAX);
+  spfInitialWait.setOptional(SPF_INITIAL_WAIT_DEFAULT);
+
+  if (!spfInitialWait.parseFromConfigSection(section)) {
+    return false;
+  }
+
+  // spf-backoff-wait
+  ConfigurationVariable<uint32_t> spfBackoffWait("spf-backoff-wait",
+                                                 std::bind(&ConfParameter::setSpfBackoffWait,
+                                                 &m_confParam, _1));
+  spfBackoffWait.setMinAndMaxValue(SPF_BACKOFF_WAIT_MIN, SPF_BACKOFF_WAIT_MAX);
+  spfBackoffWait.setOptional(SPF_BACKOFF_WAIT_DEFAULT);
+
+  if (!spfBackoffWait.parseFromConfigSection(section)) {
+    return false;
+  }
+
+  // spf-max-wait
+  ConfigurationVariable<uint32_t> spfMaxWait("spf-max-wait",
+                                             std::bind(&ConfParameter::setSpfMaxWait,
+                                             &m_confParam, _1));
+  spfMaxWait.setMinAndMaxValue(SPF_MAX_WAIT_MIN, SPF_MAX_WAIT_MAX);
+  spfMaxWait.setOptional(SPF_MAX_WAIT_DEFAULT);
+
+  if (!spfMaxWait.parseFromConfigSection(section)) {
+    return false;
+  }
+
+  // The waits are only used, and thus only checked, when the throttle is enabled
+  if (m_confParam.isSpfThrottleEnabled() &&
+      (m_confParam.getSpfInitialWait() > m_confParam.getSpfMaxWait() ||
+       m_confParam.getSpfBackoffWait() > m_confParam.getSpfMaxWait())) {
+    std::cerr << "spf-initial-wait and spf-backoff-wait must not exceed spf-max-wait" << std::endl;
+    return false;
+  }
+
+  // routing-calc-background
+  std::string routingCalcBackground = section.get<std::string>("routing-calc-background", "off");
+
+  if (boost::iequals(routingCalcBackground, "on")) {
+    m_confParam.setRoutingCalcInBackground(true);
+  }
+  else if (boost::iequals(routingCalcBackground, "off")) {
+    m_confParam.setRoutingCalcInBackground(false);
+  }
+  else {
+    std::cerr << "Invalid value for routing-calc-background. "
+              << "Allowed values: on, off" << std::endl;
+    return false;
+  }
+
+  // spf-algorithm
+  std::string spfAlgorithm = section.get<std::string>("spf-algorithm", "heap");
+
+  if (boost::iequals(spfAlgorithm, "heap")) {
+    m_confParam.setSpfAlgorithm(SpfAlgorithm::HEAP);
+  }
+  else if (boost::iequals(spfAlgorithm, "linear")) {
+    m_confParam.setSpfAlgorithm(SpfAlgorithm::LINEAR);
+  }
+  else {
+    std::cerr << "Invalid value for spf-algorithm. "
+              << "Allowed values: heap, linear" << std::endl;
+    return false;
+  }
+
+  // incremental-spf
+  std::string incrementalSpf = section.get<std::string>("incremental-spf", "off");
+
+  if (boost::iequals(incrementalSpf, "on")) {
+    m_confParam.setIncrementalSpf(true);
+  }
+  else if (boost::iequals(incrementalSpf, "off")) {
+    m_confParam.setIncrementalSpf(false);
+  }
+  else {
+    std::cerr << "Invalid value for incremental-spf. "
+              << "Allowed values: on, off" << std::endl;
+    return false;
+  }
+
+  // spf-threads
+  ConfigurationVariable<uint32_t> spfThreads("spf-threads",
+                                             std::bind(&ConfParameter::setSpfThreads,
+                                             &m_confParam, _1));
+  spfThreads.setMinAndMaxValue(SPF_THREADS_MIN, SPF_THREADS_MAX);
+  spfThreads.setOptional(SPF_THREADS_DEFAULT);
+
+  if (!spfThreads.parseFromConfigSection(section)) {
+    return false;
+  }
+
+  // rib-command-window
+  ConfigurationVariable<uint32_t> ribCommandWindow("rib-command-window",
+                                                   std::bind(&ConfParameter::setRibCommandWindow,
+                                                   &m_confParam, _1));
+  ribCommandWindow.setMinAndMaxValue(RIB_COMMAND_WINDOW_MIN, RIB_COMMAND_WINDOW_MAX);
+  ribCommandWindow.setOptional(RIB_COMMAND_WINDOW_DEFAULT);
+
+  if (!ribCommandWindow.parseFromConfigSection(section)) {
+    return false;
+  }
+
   return true;
 }
 
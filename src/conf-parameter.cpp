@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2023,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California
  *
  * This file is part of NLSR (Named-data Link State Routing).
@@ -75,7 +75,12 @@ ConfParameter::writeLog()
   NLSR_LOG_INFO("FIB Entry refresh time: " << m_lsaRefreshTime * 2);
   NLSR_LOG_INFO("LSA Interest lifetime: " << getLsaInterestLifetime());
   NLSR_LOG_INFO("Router dead interval: " << getRouterDeadInterval());
+  NLSR_LOG_INFO("Signing threads: " << m_signingThreads);
+  NLSR_LOG_INFO("Name LSA delta: " << (m_isNameLsaDeltaEnabled ? "on" : "off"));
+  NLSR_LOG_INFO("Name LSA shards: " << m_nNameLsaShards);
+  NLSR_LOG_INFO("Name LSA compact encoding: " << (m_isNameLsaCompactEnabled ? "on" : "off"));
   NLSR_LOG_INFO("Max Faces Per Prefix: " << m_maxFacesPerPrefix);
+  NLSR_LOG_INFO("RIB command window: " << m_ribCommandWindow);
   if (m_hyperbolicState == HYPERBOLIC_STATE_ON || m_hyperbolicState == HYPERBOLIC_STATE_DRY_RUN) {
     NLSR_LOG_INFO("Hyperbolic Routing: " << m_hyperbolicState);
     NLSR_LOG_INFO("Hyp R: " << m_corR);
@@ -88,7 +93,22 @@ ConfParameter::writeLog()
 
   // Event Intervals
   NLSR_LOG_INFO("Adjacency LSA build interval:  " << m_adjLsaBuildInterval);
+  NLSR_LOG_INFO("Adjacency LSA throttle: " << (m_isAdjLsaThrottleEnabled ? "on" : "off"));
+  if (m_isAdjLsaThrottleEnabled) {
+    NLSR_LOG_INFO("Adjacency LSA hold-down: " << m_adjLsaHoldDownMin << "-"
+                  << m_adjLsaHoldDownMax << " ms");
+  }
   NLSR_LOG_INFO("Routing calculation interval:  " << m_routingCalcInterval);
+  NLSR_LOG_INFO("SPF throttle: " << (m_isSpfThrottleEnabled ? "on" : "off"));
+  if (m_isSpfThrottleEnabled) {
+    NLSR_LOG_INFO("SPF initial wait: " << m_spfInitialWait << " ms, backoff wait: "
+                  << m_spfBackoffWait << " ms, max wait: " << m_spfMaxWait << " ms");
+  }
+  NLSR_LOG_INFO("Routing calculation in background: "
+                << (m_isRoutingCalcInBackground ? "on" : "off"));
+  NLSR_LOG_INFO("SPF algorithm: " << (m_spfAlgorithm == SpfAlgorithm::HEAP ? "heap" : "linear"));
+  NLSR_LOG_INFO("Incremental SPF: " << (m_isIncrementalSpfEnabled ? "on" : "off"));
+  NLSR_LOG_INFO("SPF threads: " << m_spfThreads);
 }
 
 void
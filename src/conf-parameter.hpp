@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California,
  *                           Arizona Board of Regents.
  *
@@ -41,6 +41,11 @@ enum class SyncProtocol {
   SVS,
 };
 
+enum class SpfAlgorithm {
+  LINEAR,
+  HEAP,
+};
+
 enum {
   LSA_REFRESH_TIME_MIN = 240,
   LSA_REFRESH_TIME_DEFAULT = 1800,
@@ -59,12 +64,60 @@ enum {
   ADJ_LSA_BUILD_INTERVAL_MAX = 30
 };
 
+enum {
+  ADJ_LSA_HOLD_DOWN_MIN_MIN = 0,
+  ADJ_LSA_HOLD_DOWN_MIN_DEFAULT = 500,
+  ADJ_LSA_HOLD_DOWN_MIN_MAX = 60000
+};
+
+enum {
+  ADJ_LSA_HOLD_DOWN_MAX_MIN = 1,
+  ADJ_LSA_HOLD_DOWN_MAX_DEFAULT = 10000,
+  ADJ_LSA_HOLD_DOWN_MAX_MAX = 60000
+};
+
 enum {
   ROUTING_CALC_INTERVAL_MIN = 0,
   ROUTING_CALC_INTERVAL_DEFAULT = 15,
   ROUTING_CALC_INTERVAL_MAX = 15
 };
 
+enum {
+  SPF_INITIAL_WAIT_MIN = 0,
+  SPF_INITIAL_WAIT_DEFAULT = 50,
+  SPF_INITIAL_WAIT_MAX = 60000
+};
+
+enum {
+  SPF_BACKOFF_WAIT_MIN = 1,
+  SPF_BACKOFF_WAIT_DEFAULT = 200,
+  SPF_BACKOFF_WAIT_MAX = 60000
+};
+
+enum {
+  SPF_MAX_WAIT_MIN = 1,
+  SPF_MAX_WAIT_DEFAULT = 5000,
+  SPF_MAX_WAIT_MAX = 60000
+};
+
+enum {
+  SPF_THREADS_MIN = 1,
+  SPF_THREADS_DEFAULT = 1,
+  SPF_THREADS_MAX = 64
+};
+
+enum {
+  SIGNING_THREADS_MIN = 0,
+  SIGNING_THREADS_DEFAULT = 1,
+  SIGNING_THREADS_MAX = 16
+};
+
+enum {
+  NAME_LSA_SHARDS_MIN = 1,
+  NAME_LSA_SHARDS_DEFAULT = 1,
+  NAME_LSA_SHARDS_MAX = 64
+};
+
 
 enum {
   FACE_DATASET_FETCH_TRIES_MIN = 1,
@@ -102,6 +155,12 @@ enum {
   MAX_FACES_PER_PREFIX_MAX = 60
 };
 
+enum {
+  RIB_COMMAND_WINDOW_MIN = 1,
+  RIB_COMMAND_WINDOW_DEFAULT = 64,
+  RIB_COMMAND_WINDOW_MAX = 4096
+};
+
 enum HyperbolicState {
   HYPERBOLIC_STATE_OFF = 0,
   HYPERBOLIC_STATE_ON = 1,
@@ -255,6 +314,42 @@ public:
     return m_adjLsaBuildInterval;
   }
 
+  void
+  setAdjLsaThrottle(bool isEnabled)
+  {
+    m_isAdjLsaThrottleEnabled = isEnabled;
+  }
+
+  bool
+  isAdjLsaThrottleEnabled() const
+  {
+    return m_isAdjLsaThrottleEnabled;
+  }
+
+  void
+  setAdjLsaHoldDownMin(uint32_t holdDown)
+  {
+    m_adjLsaHoldDownMin = holdDown;
+  }
+
+  ndn::time::milliseconds
+  getAdjLsaHoldDownMin() const
+  {
+    return ndn::time::milliseconds(m_adjLsaHoldDownMin);
+  }
+
+  void
+  setAdjLsaHoldDownMax(uint32_t holdDown)
+  {
+    m_adjLsaHoldDownMax = holdDown;
+  }
+
+  ndn::time::milliseconds
+  getAdjLsaHoldDownMax() const
+  {
+    return ndn::time::milliseconds(m_adjLsaHoldDownMax);
+  }
+
   void
   setRoutingCalcInterval(uint32_t interval)
   {
@@ -267,6 +362,150 @@ public:
     return m_routingCalcInterval;
   }
 
+  void
+  setSpfThrottle(bool isEnabled)
+  {
+    m_isSpfThrottleEnabled = isEnabled;
+  }
+
+  bool
+  isSpfThrottleEnabled() const
+  {
+    return m_isSpfThrottleEnabled;
+  }
+
+  void
+  setSpfInitialWait(uint32_t wait)
+  {
+    m_spfInitialWait = wait;
+  }
+
+  ndn::time::milliseconds
+  getSpfInitialWait() const
+  {
+    return ndn::time::milliseconds(m_spfInitialWait);
+  }
+
+  void
+  setSpfBackoffWait(uint32_t wait)
+  {
+    m_spfBackoffWait = wait;
+  }
+
+  ndn::time::milliseconds
+  getSpfBackoffWait() const
+  {
+    return ndn::time::milliseconds(m_spfBackoffWait);
+  }
+
+  void
+  setSpfMaxWait(uint32_t wait)
+  {
+    m_spfMaxWait = wait;
+  }
+
+  ndn::time::milliseconds
+  getSpfMaxWait() const
+  {
+    return ndn::time::milliseconds(m_spfMaxWait);
+  }
+
+  void
+  setRoutingCalcInBackground(bool isEnabled)
+  {
+    m_isRoutingCalcInBackground = isEnabled;
+  }
+
+  bool
+  isRoutingCalcInBackground() const
+  {
+    return m_isRoutingCalcInBackground;
+  }
+
+  void
+  setSpfAlgorithm(SpfAlgorithm algorithm)
+  {
+    m_spfAlgorithm = algorithm;
+  }
+
+  SpfAlgorithm
+  getSpfAlgorithm() const
+  {
+    return m_spfAlgorithm;
+  }
+
+  void
+  setIncrementalSpf(bool isEnabled)
+  {
+    m_isIncrementalSpfEnabled = isEnabled;
+  }
+
+  bool
+  isIncrementalSpfEnabled() const
+  {
+    return m_isIncrementalSpfEnabled;
+  }
+
+  void
+  setSpfThreads(uint32_t nThreads)
+  {
+    m_spfThreads = nThreads;
+  }
+
+  uint32_t
+  getSpfThreads() const
+  {
+    return m_spfThreads;
+  }
+
+  void
+  setNameLsaDelta(bool isEnabled)
+  {
+    m_isNameLsaDeltaEnabled = isEnabled;
+  }
+
+  bool
+  isNameLsaDeltaEnabled() const
+  {
+    return m_isNameLsaDeltaEnabled;
+  }
+
+  void
+  setNameLsaShards(uint32_t nShards)
+  {
+    m_nNameLsaShards = nShards;
+  }
+
+  uint32_t
+  getNameLsaShards() const
+  {
+    return m_nNameLsaShards;
+  }
+
+  void
+  setNameLsaCompact(bool isEnabled)
+  {
+    m_isNameLsaCompactEnabled = isEnabled;
+  }
+
+  bool
+  isNameLsaCompactEnabled() const
+  {
+    return m_isNameLsaCompactEnabled;
+  }
+
+  void
+  setSigningThreads(uint32_t nThreads)
+  {
+    m_signingThreads = nThreads;
+  }
+
+  uint32_t
+  getSigningThreads() const
+  {
+    return m_signingThreads;
+  }
+
   void
   setRouterDeadInterval(uint32_t rdt)
   {
@@ -391,6 +630,18 @@ public:
     return m_maxFacesPerPrefix;
   }
 
+  void
+  setRibCommandWindow(uint32_t window)
+  {
+    m_ribCommandWindow = window;
+  }
+
+  uint32_t
+  getRibCommandWindow() const
+  {
+    return m_ribCommandWindow;
+  }
+
   void
   setStateFileDir(const std::string& ssfd)
   {
@@ -504,7 +755,22 @@ private:
   uint32_t  m_lsaRefreshTime;
 
   uint32_t m_adjLsaBuildInterval;
+  bool m_isAdjLsaThrottleEnabled = false;
+  uint32_t m_adjLsaHoldDownMin = ADJ_LSA_HOLD_DOWN_MIN_DEFAULT;
+  uint32_t m_adjLsaHoldDownMax = ADJ_LSA_HOLD_DOWN_MAX_DEFAULT;
   uint32_t m_routingCalcInterval;
+  bool m_isSpfThrottleEnabled = false;
+  uint32_t m_spfInitialWait = SPF_INITIAL_WAIT_DEFAULT;
+  uint32_t m_spfBackoffWait = SPF_BACKOFF_WAIT_DEFAULT;
+  uint32_t m_spfMaxWait = SPF_MAX_WAIT_DEFAULT;
+  bool m_isRoutingCalcInBackground = false;
+  SpfAlgorithm m_spfAlgorithm = SpfAlgorithm::HEAP;
+  bool m_isIncrementalSpfEnabled = false;
+  uint32_t m_spfThreads = SPF_THREADS_DEFAULT;
+  uint32_t m_signingThreads = SIGNING_THREADS_DEFAULT;
+  bool m_isNameLsaDeltaEnabled = false;
+  uint32_t m_nNameLsaShards = NAME_LSA_SHARDS_DEFAULT;
+  bool m_isNameLsaCompactEnabled = false;
 
   uint32_t m_faceDatasetFetchTries;
   ndn::time::seconds m_faceDatasetFetchInterval;
@@ -522,6 +788,7 @@ private:
   std::vector<double> m_corTheta;
 
   uint32_t m_maxFacesPerPrefix;
+  uint32_t m_ribCommandWindow = RIB_COMMAND_WINDOW_DEFAULT;
 
   std::string m_stateFileDir;
 
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California
  *
  * This file is part of NLSR (Named-data Link State Routing).
@@ -30,12 +30,11 @@ namespace nlsr {
 
 INIT_LOGGER(HelloProtocol);
 
-HelloProtocol::HelloProtocol(ndn::Face& face, ndn::KeyChain& keyChain,
-                             ConfParameter& confParam, RoutingTable& routingTable,
-                             Lsdb& lsdb)
+HelloProtocol::HelloProtocol(ndn::Face& face, ConfParameter& confParam,
+                             RoutingTable& routingTable, Lsdb& lsdb)
   : m_face(face)
   , m_scheduler(m_face.getIoContext())
-  , m_keyChain(keyChain)
+  , m_signingService(lsdb.getSigningService())
   , m_signingInfo(confParam.getSigningInfo())
   , m_confParam(confParam)
   , m_routingTable(routingTable)
@@ -136,12 +135,14 @@ HelloProtocol::processInterest(const ndn::Name& name,
     data->setContent(ndn::make_span(reinterpret_cast<const uint8_t*>(INFO_COMPONENT.data()),
                                     INFO_COMPONENT.size()));
 
-    m_keyChain.sign(*data, m_signingInfo);
-
-    NLSR_LOG_DEBUG("Sending out data for name: " << interest.getName());
-    m_face.put(*data);
-    // increment SENT_HELLO_DATA
-    hpIncrementSignal(Statistics::PacketType::SENT_HELLO_DATA);
+    // The reply is sent once signed, possibly after this function returns; it does not wait
+    // for the signing of LSA segments, lest the neighbor consider this router down
+    m_signingService.sign(std::move(data), m_signingInfo, [this] (const auto& reply) {
+      NLSR_LOG_DEBUG("Sending out data for name: " << reply->getName());
+      m_face.put(*reply);
+      // increment SENT_HELLO_DATA
+      hpIncrementSignal(Statistics::PacketType::SENT_HELLO_DATA);
+    }, security::SigningService::Priority::URGENT);
 
     auto adjacent = m_adjacencyList.findAdjacent(neighbor);
     // If this neighbor was previously inactive, send our own hello interest, too
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2023,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California,
  *                           Arizona Board of Regents.
  *
@@ -38,8 +38,8 @@ namespace nlsr {
 class HelloProtocol
 {
 public:
-  HelloProtocol(ndn::Face& face, ndn::KeyChain& keyChain, ConfParameter& confParam,
-                RoutingTable& routingTable, Lsdb& lsdb);
+  HelloProtocol(ndn::Face& face, ConfParameter& confParam, RoutingTable& routingTable,
+                Lsdb& lsdb);
 
   /*! \brief Sends a Hello Interest packet.
    *
@@ -131,7 +131,7 @@ public:
 private:
   ndn::Face& m_face;
   ndn::Scheduler m_scheduler;
-  ndn::security::KeyChain& m_keyChain;
+  security::SigningService& m_signingService;
   const ndn::security::SigningInfo& m_signingInfo;
   ConfParameter& m_confParam;
   RoutingTable& m_routingTable;
@@ -0,0 +1,103 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "lsa-segment-cache.hpp"
+
+#include <algorithm>
+
+namespace nlsr {
+
+LsaSegmentCache::LsaSegmentCache(size_t capacity)
+  : m_capacity(capacity)
+{
+}
+
+bool
+LsaSegmentCache::insert(Lsa::Type type, uint32_t shard, uint64_t seqNo, const ndn::Block& wire,
+                        Segments segments)
+{
+  BOOST_ASSERT(!segments.empty());
+
+  erase(type, shard);
+
+  size_t nBytes = 0;
+  for (const auto& data : segments) {
+    nBytes += data->wireEncode().size();
+  }
+  if (nBytes > m_capacity) {
+    return false;
+  }
+
+  while (m_nBytes + nBytes > m_capacity) {
+    m_nBytes -= m_entries.front().nBytes;
+    m_entries.pop_front();
+  }
+
+  ndn::Name versionedName = segments.front()->getName().getPrefix(-1);
+  m_entries.push_back({type, shard, seqNo, wire, std::move(versionedName), std::move(segments),
+                       nBytes});
+  m_nBytes += nBytes;
+  return true;
+}
+
+const LsaSegmentCache::Segments*
+LsaSegmentCache::find(Lsa::Type type, uint32_t shard, uint64_t seqNo,
+                      const ndn::Block& wire) const
+{
+  auto it = std::find_if(m_entries.begin(), m_entries.end(), [&] (const Entry& entry) {
+    return entry.type == type && entry.shard == shard;
+  });
+  if (it == m_entries.end() || it->seqNo != seqNo || it->wire != wire) {
+    return nullptr;
+  }
+  return &it->segments;
+}
+
+std::shared_ptr<ndn::Data>
+LsaSegmentCache::findSegment(const ndn::Name& name) const
+{
+  if (name.empty() || !name[-1].isSegment()) {
+    return nullptr;
+  }
+
+  auto segmentNo = name[-1].toSegment();
+  for (const auto& entry : m_entries) {
+    if (segmentNo < entry.segments.size() && entry.versionedName.isPrefixOf(name) &&
+        entry.versionedName.size() + 1 == name.size()) {
+      return entry.segments[segmentNo];
+    }
+  }
+  return nullptr;
+}
+
+void
+LsaSegmentCache::erase(Lsa::Type type, uint32_t shard)
+{
+  auto it = std::find_if(m_entries.begin(), m_entries.end(), [&] (const Entry& entry) {
+    return entry.type == type && entry.shard == shard;
+  });
+  if (it != m_entries.end()) {
+    m_nBytes -= it->nBytes;
+    m_entries.erase(it);
+  }
+}
+
+} // namespace nlsr
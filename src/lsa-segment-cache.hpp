@@ -0,0 +1,135 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NLSR_LSA_SEGMENT_CACHE_HPP
+#define NLSR_LSA_SEGMENT_CACHE_HPP
+
+#include "lsa/lsa.hpp"
+
+#include <ndn-cxx/data.hpp>
+
+#include <boost/noncopyable.hpp>
+
+#include <list>
+#include <vector>
+
+namespace nlsr {
+
+/**
+ * @brief Signed segments of the router's own LSAs.
+ *
+ * Each entry holds the Data packets of one version of an own LSA, keyed by LSA type, shard,
+ * and sequence number. Only the current version of an own LSA is ever served, so inserting a
+ * version replaces any other version of the same type and shard. The total size of the cached
+ * packets is kept within a capacity in bytes by evicting the oldest entries.
+ *
+ * An entry also records the encoding of the LSA its segments were produced from, and is only
+ * returned for that same encoding.
+ */
+class LsaSegmentCache : boost::noncopyable
+{
+public:
+  using Segments = std::vector<std::shared_ptr<ndn::Data>>;
+
+  /**
+   * @param capacity Maximum total wire size of the cached segments, in bytes.
+   */
+  explicit
+  LsaSegmentCache(size_t capacity);
+
+  /**
+   * @brief Cache the segments of an LSA, replacing any other version of the same type and shard.
+   * @param wire Encoding of the LSA that was segmented.
+   * @param segments Signed segments, in order; all must share the same versioned name prefix.
+   * @return whether the segments have been cached; they are not if they exceed the capacity.
+   */
+  bool
+  insert(Lsa::Type type, uint32_t shard, uint64_t seqNo, const ndn::Block& wire,
+         Segments segments);
+
+  /**
+   * @brief Find the segments of an LSA.
+   * @param wire Current encoding of the LSA.
+   * @return the segments, or nullptr if they are not cached or were produced from a different
+   *         encoding.
+   */
+  const Segments*
+  find(Lsa::Type type, uint32_t shard, uint64_t seqNo, const ndn::Block& wire) const;
+
+  /**
+   * @brief Find a segment by name.
+   * @param name /<versioned LSA name>/<segment number>
+   */
+  std::shared_ptr<ndn::Data>
+  findSegment(const ndn::Name& name) const;
+
+  /**
+   * @brief Remove the cached segments of a shard of an LSA type, if any.
+   */
+  void
+  erase(Lsa::Type type, uint32_t shard);
+
+  /**
+   * @brief Return the number of cached LSA versions.
+   */
+  size_t
+  size() const
+  {
+    return m_entries.size();
+  }
+
+  /**
+   * @brief Return the total wire size of the cached segments, in bytes.
+   */
+  size_t
+  getNBytes() const
+  {
+    return m_nBytes;
+  }
+
+  size_t
+  getCapacity() const
+  {
+    return m_capacity;
+  }
+
+private:
+  struct Entry
+  {
+    Lsa::Type type;
+    uint32_t shard;
+    uint64_t seqNo;
+    ndn::Block wire;
+    /// Name of the segments without the segment number.
+    ndn::Name versionedName;
+    Segments segments;
+    size_t nBytes;
+  };
+
+  /// Entries in insertion order, at most one per LSA type and shard.
+  std::list<Entry> m_entries;
+  const size_t m_capacity;
+  size_t m_nBytes = 0;
+};
+
+} // namespace nlsr
+
+#endif // NLSR_LSA_SEGMENT_CACHE_HPP
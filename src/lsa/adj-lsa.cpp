@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California,
  *                           Arizona Board of Regents.
  *
@@ -40,13 +40,24 @@ AdjLsa::AdjLsa(const ndn::Block& block)
   wireDecode(block);
 }
 
+AdjLsa::AdjLsa(const ndn::Block& block, const AdjLsa& previous)
+{
+  if (!previous.hasSameEncodedContent(block)) {
+    wireDecode(block);
+    return;
+  }
+
+  wireDecodeHeader(block);
+  m_adl = previous.m_adl;
+}
+
 template<ndn::encoding::Tag TAG>
 size_t
 AdjLsa::wireEncode(ndn::EncodingImpl<TAG>& block) const
 {
   size_t totalLength = 0;
 
-  auto list = m_adl.getAdjList();
+  auto list = m_adl->getAdjList();
   for (auto it = list.rbegin(); it != list.rend(); ++it) {
     totalLength += it->wireEncode(block);
   }
@@ -79,8 +90,8 @@ AdjLsa::wireEncode() const
   return m_wire;
 }
 
-void
-AdjLsa::wireDecode(const ndn::Block& wire)
+ndn::Block::element_const_iterator
+AdjLsa::wireDecodeHeader(const ndn::Block& wire)
 {
   m_wire = wire;
 
@@ -100,16 +111,24 @@ AdjLsa::wireDecode(const ndn::Block& wire)
     NDN_THROW(Error("Missing required Lsa field"));
   }
 
-  AdjacencyList adl;
+  return val;
+}
+
+void
+AdjLsa::wireDecode(const ndn::Block& wire)
+{
+  auto val = wireDecodeHeader(wire);
+
+  auto adl = std::make_shared<AdjacencyList>();
   for (; val != m_wire.elements_end(); ++val) {
     if (val->type() == nlsr::tlv::Adjacency) {
-      adl.insert(Adjacent(*val));
+      adl->insert(Adjacent(*val));
     }
     else {
       NDN_THROW(Error("Adjacency", val->type()));
     }
   }
-  m_adl = adl;
+  m_adl = std::move(adl);
 }
 
 void
@@ -118,7 +137,7 @@ AdjLsa::print(std::ostream& os) const
   os << "      Adjacent(s):\n";
 
   int adjacencyIndex = 0;
-  for (const auto& adjacency : m_adl) {
+  for (const auto& adjacency : *m_adl) {
     os << "        Adjacent " << adjacencyIndex++
        << ": (name=" << adjacency.getName()
        << ", uri="   << adjacency.getFaceUri()
@@ -131,10 +150,8 @@ AdjLsa::update(const std::shared_ptr<Lsa>& lsa)
 {
   auto alsa = std::static_pointer_cast<AdjLsa>(lsa);
   if (*this != *alsa) {
-    resetAdl();
-    for (const auto& adjacent : alsa->getAdl()) {
-      addAdjacent(adjacent);
-    }
+    m_wire.reset();
+    m_adl = alsa->m_adl;
     return {true, std::list<PrefixInfo>{}, std::list<PrefixInfo>{}};
   }
   return {false, std::list<PrefixInfo>{}, std::list<PrefixInfo>{}};
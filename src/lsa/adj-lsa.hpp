@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California,
  *                           Arizona Board of Regents.
  *
@@ -53,6 +53,14 @@ public:
   explicit
   AdjLsa(const ndn::Block& block);
 
+  /**
+   * @brief Decode @p block, a newer version of @p previous.
+   *
+   * If @p block lists the same adjacencies as @p previous, only the Lsa field is decoded and
+   * the adjacency list of @p previous is shared instead of being decoded again.
+   */
+  AdjLsa(const ndn::Block& block, const AdjLsa& previous);
+
   Lsa::Type
   getType() const override
   {
@@ -68,33 +76,36 @@ public:
   const AdjacencyList&
   getAdl() const
   {
-    return m_adl;
+    return *m_adl;
   }
 
   void
   resetAdl()
   {
     m_wire.reset();
-    m_adl.reset();
+    m_adl = std::make_shared<AdjacencyList>();
   }
 
   void
   addAdjacent(const Adjacent& adj)
   {
     m_wire.reset();
-    m_adl.insert(adj);
+    if (m_adl.use_count() > 1) {
+      m_adl = std::make_shared<AdjacencyList>(*m_adl);
+    }
+    m_adl->insert(adj);
   }
 
   const_iterator
   begin() const
   {
-    return m_adl.begin();
+    return m_adl->begin();
   }
 
   const_iterator
   end() const
   {
-    return m_adl.end();
+    return m_adl->end();
   }
 
   template<ndn::encoding::Tag TAG>
@@ -111,6 +122,9 @@ public:
   update(const std::shared_ptr<Lsa>& lsa) override;
 
 private:
+  ndn::Block::element_const_iterator
+  wireDecodeHeader(const ndn::Block& wire);
+
   void
   print(std::ostream& os) const override;
 
@@ -122,11 +136,12 @@ private: // non-member operators
   friend bool
   operator==(const AdjLsa& lhs, const AdjLsa& rhs)
   {
-    return lhs.m_adl == rhs.m_adl;
+    return lhs.m_adl == rhs.m_adl || *lhs.m_adl == *rhs.m_adl;
   }
 
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
-  AdjacencyList m_adl;
+  /// Copies of an LSA share the adjacency list until one of them modifies it.
+  std::shared_ptr<AdjacencyList> m_adl = std::make_shared<AdjacencyList>();
 };
 
 NDN_CXX_DECLARE_WIRE_ENCODE_INSTANTIATIONS(AdjLsa);
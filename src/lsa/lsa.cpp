@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California,
  *                           Arizona Board of Regents.
  *
@@ -22,6 +22,10 @@
 #include "lsa.hpp"
 #include "tlv-nlsr.hpp"
 
+#include <algorithm>
+#include <limits>
+#include <sstream>
+
 namespace nlsr {
 
 Lsa::Lsa(const ndn::Name& originRouter, uint64_t seqNo,
@@ -97,6 +101,24 @@ Lsa::wireDecode(const ndn::Block& wire)
   }
 }
 
+bool
+Lsa::hasSameEncodedContent(const ndn::Block& wire) const
+{
+  const auto& ownWire = wireEncode();
+  if (ownWire.type() != wire.type()) {
+    return false;
+  }
+
+  ownWire.parse();
+  wire.parse();
+  if (ownWire.elements().empty() || wire.elements().empty()) {
+    return false;
+  }
+  // Both encodings start with the Lsa field
+  return std::equal(ownWire.elements().front().end(), ownWire.value_end(),
+                    wire.elements().front().end(), wire.value_end());
+}
+
 std::ostream&
 operator<<(std::ostream& os, const Lsa& lsa)
 {
@@ -150,4 +172,47 @@ operator>>(std::istream& is, Lsa::Type& type)
   return is;
 }
 
+std::string
+makeLsaTypeComponent(Lsa::Type type, uint32_t shard)
+{
+  std::ostringstream os;
+  os << type;
+  if (shard != 0) {
+    os << '-' << shard;
+  }
+  return os.str();
+}
+
+std::pair<Lsa::Type, uint32_t>
+parseLsaTypeComponent(const ndn::name::Component& component)
+{
+  std::string typeString = component.toUri();
+  uint32_t shard = 0;
+
+  auto dash = typeString.find('-');
+  if (dash != std::string::npos) {
+    try {
+      size_t nParsed = 0;
+      auto number = std::stoul(typeString.substr(dash + 1), &nParsed);
+      if (nParsed != typeString.size() - dash - 1 || number == 0 ||
+          number > std::numeric_limits<uint32_t>::max()) {
+        return {Lsa::Type::BASE, 0};
+      }
+      shard = static_cast<uint32_t>(number);
+    }
+    catch (const std::logic_error&) {
+      return {Lsa::Type::BASE, 0};
+    }
+    typeString.resize(dash);
+  }
+
+  Lsa::Type type;
+  std::istringstream(typeString) >> type;
+  // Only Name LSAs are sharded
+  if (shard != 0 && type != Lsa::Type::NAME) {
+    return {Lsa::Type::BASE, 0};
+  }
+  return {type, shard};
+}
+
 } // namespace nlsr
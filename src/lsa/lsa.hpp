@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California,
  *                           Arizona Board of Regents.
  *
@@ -25,10 +25,10 @@
 #include "common.hpp"
 #include "name-prefix-list.hpp"
 #include "test-access-control.hpp"
-
-#include <ndn-cxx/util/scheduler.hpp>
+#include "utility/timer-wheel.hpp"
 
 #include <list>
+#include <utility>
 
 
 namespace nlsr {
@@ -76,6 +76,17 @@ public:
   virtual Type
   getType() const = 0;
 
+  /**
+   * @brief Return the shard of the origin router's LSAs of this type that this LSA carries.
+   *
+   * Only Name LSAs may be split into shards; all other LSAs are shard 0.
+   */
+  virtual uint32_t
+  getShard() const
+  {
+    return 0;
+  }
+
   void
   setSeqNo(uint64_t seqNo)
   {
@@ -109,17 +120,49 @@ public:
   }
 
   void
-  setExpiringEventId(ndn::scheduler::EventId eid)
+  setExpiringEventId(const util::TimerWheel::EventId& eid)
   {
     m_expiringEventId = eid;
   }
 
+  const util::TimerWheel::EventId&
+  getExpiringEventId() const
+  {
+    return m_expiringEventId;
+  }
+
+  /**
+   * @brief Return the version of the LSDB in which this LSA was installed or replaced,
+   *        or zero if it has not been installed.
+   */
+  uint64_t
+  getLsdbVersion() const
+  {
+    return m_lsdbVersion;
+  }
+
+  void
+  setLsdbVersion(uint64_t version)
+  {
+    m_lsdbVersion = version;
+  }
+
   virtual std::tuple<bool, std::list<PrefixInfo>, std::list<PrefixInfo>>
   update(const std::shared_ptr<Lsa>& lsa) = 0;
 
   virtual const ndn::Block&
   wireEncode() const = 0;
 
+  /**
+   * @brief Return whether @p wire, an encoding of another version of this LSA, carries the
+   *        same elements after its Lsa field as the encoding of this LSA.
+   *
+   * This tells, without decoding @p wire, that the versions only differ in their sequence
+   * number and expiration time. The encoding of this LSA is produced if it is not cached.
+   */
+  bool
+  hasSameEncodedContent(const ndn::Block& wire) const;
+
 protected:
   template<ndn::encoding::Tag TAG>
   size_t
@@ -139,7 +182,8 @@ PUBLIC_WITH_TESTS_ELSE_PROTECTED:
   ndn::Name m_originRouter;
   uint64_t m_seqNo = 0;
   ndn::time::system_clock::time_point m_expirationTimePoint;
-  ndn::scheduler::ScopedEventId m_expiringEventId;
+  util::TimerWheel::EventId m_expiringEventId;
+  uint64_t m_lsdbVersion = 0;
 
   mutable ndn::Block m_wire;
 };
@@ -152,6 +196,23 @@ operator<<(std::ostream& os, const Lsa::Type& type);
 std::istream&
 operator>>(std::istream& is, Lsa::Type& type);
 
+/**
+ * @brief Return the name component that identifies a shard of LSAs of a type.
+ *
+ * The component is the type name for shard 0, so that unsharded LSAs keep their names,
+ * and the type name followed by a dash and the shard number otherwise, e.g. NAME-3.
+ */
+std::string
+makeLsaTypeComponent(Lsa::Type type, uint32_t shard = 0);
+
+/**
+ * @brief Parse a name component made by makeLsaTypeComponent().
+ * @return The LSA type and the shard; the type is Lsa::Type::BASE if @p component is not
+ *         recognized.
+ */
+std::pair<Lsa::Type, uint32_t>
+parseLsaTypeComponent(const ndn::name::Component& component);
+
 } // namespace nlsr
 
 #endif // NLSR_LSA_LSA_HPP
@@ -0,0 +1,140 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "name-lsa-delta.hpp"
+#include "tlv-nlsr.hpp"
+
+namespace nlsr {
+
+NameLsaDelta::NameLsaDelta(uint64_t baseSeqNo, NameLsa added, std::list<ndn::Name> removed)
+  : m_baseSeqNo(baseSeqNo)
+  , m_added(std::move(added))
+  , m_removed(std::move(removed))
+{
+}
+
+NameLsaDelta::NameLsaDelta(const ndn::Block& block)
+{
+  wireDecode(block);
+}
+
+std::shared_ptr<NameLsa>
+NameLsaDelta::apply(const NameLsa& base) const
+{
+  if (base.getOriginRouter() != m_added.getOriginRouter() ||
+      base.getShard() != m_added.getShard() || base.getSeqNo() != m_baseSeqNo) {
+    NDN_THROW(std::invalid_argument("Name LSA is not the base of the delta"));
+  }
+
+  auto lsa = std::make_shared<NameLsa>(base);
+  lsa->setSeqNo(m_added.getSeqNo());
+  lsa->setExpirationTimePoint(m_added.getExpirationTimePoint());
+  for (const auto& name : m_removed) {
+    lsa->removeName(PrefixInfo(name, 0));
+  }
+  for (const auto& prefixInfo : m_added.getNpl().getPrefixInfo()) {
+    lsa->addName(prefixInfo);
+  }
+  return lsa;
+}
+
+template<ndn::encoding::Tag TAG>
+size_t
+NameLsaDelta::wireEncode(ndn::EncodingImpl<TAG>& block) const
+{
+  size_t totalLength = 0;
+
+  for (auto it = m_removed.rbegin(); it != m_removed.rend(); ++it) {
+    totalLength += it->wireEncode(block);
+  }
+
+  totalLength += m_added.wireEncode(block);
+  totalLength += prependNonNegativeIntegerBlock(block, nlsr::tlv::BaseSequenceNumber,
+                                                m_baseSeqNo);
+
+  totalLength += block.prependVarNumber(totalLength);
+  totalLength += block.prependVarNumber(nlsr::tlv::NameLsaDelta);
+
+  return totalLength;
+}
+
+NDN_CXX_DEFINE_WIRE_ENCODE_INSTANTIATIONS(NameLsaDelta);
+
+const ndn::Block&
+NameLsaDelta::wireEncode() const
+{
+  if (m_wire.hasWire()) {
+    return m_wire;
+  }
+
+  ndn::EncodingEstimator estimator;
+  size_t estimatedSize = wireEncode(estimator);
+
+  ndn::EncodingBuffer buffer(estimatedSize, 0);
+  wireEncode(buffer);
+
+  m_wire = buffer.block();
+
+  return m_wire;
+}
+
+void
+NameLsaDelta::wireDecode(const ndn::Block& wire)
+{
+  m_wire = wire;
+
+  if (m_wire.type() != nlsr::tlv::NameLsaDelta) {
+    NDN_THROW(Error("NameLsaDelta", m_wire.type()));
+  }
+
+  m_wire.parse();
+
+  auto val = m_wire.elements_begin();
+
+  if (val != m_wire.elements_end() && val->type() == nlsr::tlv::BaseSequenceNumber) {
+    m_baseSeqNo = ndn::readNonNegativeInteger(*val);
+    ++val;
+  }
+  else {
+    NDN_THROW(Error("Missing required BaseSequenceNumber field"));
+  }
+
+  if (val != m_wire.elements_end() &&
+      (val->type() == nlsr::tlv::NameLsa || val->type() == nlsr::tlv::CompactNameLsa)) {
+    m_added.wireDecode(*val);
+    ++val;
+  }
+  else {
+    NDN_THROW(Error("Missing required NameLsa field"));
+  }
+
+  m_removed.clear();
+  for (; val != m_wire.elements_end(); ++val) {
+    if (val->type() == ndn::tlv::Name) {
+      m_removed.emplace_back(*val);
+    }
+    else {
+      NDN_THROW(Error("Name", val->type()));
+    }
+  }
+}
+
+} // namespace nlsr
@@ -0,0 +1,106 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NLSR_LSA_NAME_LSA_DELTA_HPP
+#define NLSR_LSA_NAME_LSA_DELTA_HPP
+
+#include "name-lsa.hpp"
+
+namespace nlsr {
+
+/**
+ * @brief Represents the changes of a Name LSA since an earlier version of it.
+ *
+ * A router that holds the base version of the Name LSA obtains the new version by applying
+ * the delta to it, instead of fetching the whole prefix list. Only additions and withdrawals
+ * of names are conveyed, as NameLsa::update() does not act upon cost changes.
+ *
+ * NameLsaDelta is encoded as:
+ * @code{.abnf}
+ * NameLsaDelta = NAME-LSA-DELTA-TYPE TLV-LENGTH
+ *                  BaseSequenceNumber
+ *                  (NameLsa / CompactNameLsa) ; the new version, listing only the added names
+ *                  *Name   ; withdrawn names
+ * @endcode
+ */
+class NameLsaDelta
+{
+public:
+  using Error = Lsa::Error;
+
+  NameLsaDelta() = default;
+
+  NameLsaDelta(uint64_t baseSeqNo, NameLsa added, std::list<ndn::Name> removed);
+
+  explicit
+  NameLsaDelta(const ndn::Block& block);
+
+  uint64_t
+  getBaseSeqNo() const
+  {
+    return m_baseSeqNo;
+  }
+
+  /**
+   * @brief Return the header of the new version along with the added names.
+   */
+  const NameLsa&
+  getAdded() const
+  {
+    return m_added;
+  }
+
+  const std::list<ndn::Name>&
+  getRemoved() const
+  {
+    return m_removed;
+  }
+
+  /**
+   * @brief Construct the new version of the Name LSA from its base version.
+   * @throw std::invalid_argument @p base is not the base version of this delta
+   */
+  std::shared_ptr<NameLsa>
+  apply(const NameLsa& base) const;
+
+  template<ndn::encoding::Tag TAG>
+  size_t
+  wireEncode(ndn::EncodingImpl<TAG>& block) const;
+
+  const ndn::Block&
+  wireEncode() const;
+
+  void
+  wireDecode(const ndn::Block& wire);
+
+private:
+  uint64_t m_baseSeqNo = 0;
+  NameLsa m_added;
+  std::list<ndn::Name> m_removed;
+
+  mutable ndn::Block m_wire;
+};
+
+NDN_CXX_DECLARE_WIRE_ENCODE_INSTANTIATIONS(NameLsaDelta);
+
+} // namespace nlsr
+
+#endif // NLSR_LSA_NAME_LSA_DELTA_HPP
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California,
  *                           Arizona Board of Regents.
  *
@@ -22,8 +22,93 @@
 #include "name-lsa.hpp"
 #include "tlv-nlsr.hpp"
 
+#include <vector>
+
 namespace nlsr {
 
+template<ndn::encoding::Tag TAG>
+static size_t
+prependCompactPrefixInfo(ndn::EncodingImpl<TAG>& block, const PrefixInfo& prefixInfo,
+                         const PrefixInfo* previous)
+{
+  const auto& name = prefixInfo.getName();
+  size_t nShared = 0;
+  double previousCost = 0;
+  if (previous != nullptr) {
+    const auto& previousName = previous->getName();
+    while (nShared < name.size() && nShared < previousName.size() &&
+           name[nShared] == previousName[nShared]) {
+      ++nShared;
+    }
+    previousCost = previous->getCost();
+  }
+
+  size_t totalLength = 0;
+
+  if (prefixInfo.getCost() != previousCost) {
+    totalLength += ndn::encoding::prependDoubleBlock(block, nlsr::tlv::Cost, prefixInfo.getCost());
+  }
+
+  size_t nameLength = 0;
+  for (size_t i = name.size(); i > nShared; --i) {
+    nameLength += name[i - 1].wireEncode(block);
+  }
+  nameLength += block.prependVarNumber(nameLength);
+  nameLength += block.prependVarNumber(ndn::tlv::Name);
+  totalLength += nameLength;
+
+  if (nShared > 0) {
+    totalLength += prependNonNegativeIntegerBlock(block, nlsr::tlv::SharedComponents, nShared);
+  }
+
+  totalLength += block.prependVarNumber(totalLength);
+  totalLength += block.prependVarNumber(nlsr::tlv::CompactPrefixInfo);
+
+  return totalLength;
+}
+
+static void
+decodeCompactPrefixInfos(ndn::Block::element_const_iterator val,
+                         ndn::Block::element_const_iterator end, NamePrefixList& npl)
+{
+  ndn::Name previousName;
+  double previousCost = 0;
+
+  for (; val != end; ++val) {
+    if (val->type() != nlsr::tlv::CompactPrefixInfo) {
+      NDN_THROW(NameLsa::Error("CompactPrefixInfo", val->type()));
+    }
+    val->parse();
+    auto element = val->elements_begin();
+
+    size_t nShared = 0;
+    if (element != val->elements_end() && element->type() == nlsr::tlv::SharedComponents) {
+      nShared = ndn::readNonNegativeIntegerAs<size_t>(*element);
+      ++element;
+    }
+    if (nShared > previousName.size()) {
+      NDN_THROW(NameLsa::Error("SharedComponents exceeds the length of the previous prefix"));
+    }
+
+    if (element == val->elements_end() || element->type() != ndn::tlv::Name) {
+      NDN_THROW(NameLsa::Error("Missing required Name field"));
+    }
+    ndn::Name name = previousName.getPrefix(nShared);
+    name.append(ndn::Name(*element));
+    ++element;
+
+    double cost = previousCost;
+    if (element != val->elements_end() && element->type() == nlsr::tlv::Cost) {
+      cost = ndn::encoding::readDouble(*element);
+      ++element;
+    }
+
+    npl.insert(PrefixInfo(name, cost));
+    previousName = std::move(name);
+    previousCost = cost;
+  }
+}
+
 NameLsa::NameLsa(const ndn::Name& originRouter, uint64_t seqNo,
                  const ndn::time::system_clock::time_point& timepoint,
                  const NamePrefixList& npl)
@@ -39,22 +124,48 @@ NameLsa::NameLsa(const ndn::Block& block)
   wireDecode(block);
 }
 
+NameLsa::NameLsa(const ndn::Block& block, const NameLsa& previous)
+{
+  if (!previous.hasSameEncodedContent(block)) {
+    wireDecode(block);
+    return;
+  }
+
+  wireDecodeHeader(block);
+  m_npl = previous.m_npl;
+}
+
 template<ndn::encoding::Tag TAG>
 size_t
 NameLsa::wireEncode(ndn::EncodingImpl<TAG>& block) const
 {
   size_t totalLength = 0;
 
-  auto names = m_npl.getPrefixInfo();
+  auto names = m_npl->getPrefixInfo();
+
+  if (m_isCompact) {
+    // Each prefix is encoded relative to the one before it
+    std::vector<PrefixInfo> prefixes(names.begin(), names.end());
+    for (size_t i = prefixes.size(); i > 0; --i) {
+      totalLength += prependCompactPrefixInfo(block, prefixes[i - 1],
+                                              i > 1 ? &prefixes[i - 2] : nullptr);
+    }
+  }
+  else {
+    for (auto it = names.rbegin();  it != names.rend(); ++it) {
+      totalLength += it->wireEncode(block);
+    }
+  }
 
-  for (auto it = names.rbegin();  it != names.rend(); ++it) {
-    totalLength += it->wireEncode(block);
+  if (m_shard != 0) {
+    totalLength += prependNonNegativeIntegerBlock(block, nlsr::tlv::NameLsaShard, m_shard);
   }
 
   totalLength += Lsa::wireEncode(block);
 
   totalLength += block.prependVarNumber(totalLength);
-  totalLength += block.prependVarNumber(nlsr::tlv::NameLsa);
+  totalLength += block.prependVarNumber(m_isCompact ? nlsr::tlv::CompactNameLsa :
+                                                      nlsr::tlv::NameLsa);
 
   return totalLength;
 }
@@ -79,14 +190,15 @@ NameLsa::wireEncode() const
   return m_wire;
 }
 
-void
-NameLsa::wireDecode(const ndn::Block& wire)
+ndn::Block::element_const_iterator
+NameLsa::wireDecodeHeader(const ndn::Block& wire)
 {
   m_wire = wire;
 
-  if (m_wire.type() != nlsr::tlv::NameLsa) {
+  if (m_wire.type() != nlsr::tlv::NameLsa && m_wire.type() != nlsr::tlv::CompactNameLsa) {
     NDN_THROW(Error("NameLsa", m_wire.type()));
   }
+  m_isCompact = m_wire.type() == nlsr::tlv::CompactNameLsa;
 
   m_wire.parse();
 
@@ -100,25 +212,48 @@ NameLsa::wireDecode(const ndn::Block& wire)
     NDN_THROW(Error("Missing required Lsa field"));
   }
 
-  NamePrefixList npl;
+  m_shard = 0;
+  if (val != m_wire.elements_end() && val->type() == nlsr::tlv::NameLsaShard) {
+    m_shard = ndn::readNonNegativeIntegerAs<uint32_t>(*val);
+    ++val;
+  }
+
+  return val;
+}
+
+void
+NameLsa::wireDecode(const ndn::Block& wire)
+{
+  auto val = wireDecodeHeader(wire);
+
+  auto npl = std::make_shared<NamePrefixList>();
+  if (m_isCompact) {
+    decodeCompactPrefixInfos(val, m_wire.elements_end(), *npl);
+    m_npl = std::move(npl);
+    return;
+  }
+
   for (; val != m_wire.elements_end(); ++val) {
     if (val->type() == nlsr::tlv::PrefixInfo) {
       //TODO: Implement this structure as a type instead and add decoding
-      npl.insert(PrefixInfo(*val));
+      npl->insert(PrefixInfo(*val));
     }
     else {
       NDN_THROW(Error("Name", val->type()));
     }
   }
-  m_npl = npl;
+  m_npl = std::move(npl);
 }
 
 void
 NameLsa::print(std::ostream& os) const
 {
+  if (m_shard != 0) {
+    os << "      Shard              : " << m_shard << "\n";
+  }
   os << "      Names:\n";
   int i = 0;
-  for (const auto& name : m_npl.getPrefixInfo()) {
+  for (const auto& name : m_npl->getPrefixInfo()) {
     os << "        Name " << i << ": " << name.getName()
        << " | Cost: " << name.getCost() << "\n";
     i++;
@@ -131,11 +266,21 @@ NameLsa::update(const std::shared_ptr<Lsa>& lsa)
   auto nlsa = std::static_pointer_cast<NameLsa>(lsa);
   bool updated = false;
 
+  // The encoding follows the latest version
+  if (m_isCompact != nlsa->m_isCompact) {
+    setCompact(nlsa->m_isCompact);
+  }
+
+  // Versions sharing their prefix list have the same prefixes
+  if (m_npl == nlsa->m_npl) {
+    return {false, {}, {}};
+  }
+
   // Obtain the set difference of the current and the incoming
   // name prefix sets, and add those.
 
   std::list<ndn::Name> newNames = nlsa->getNpl().getNames();
-  std::list<ndn::Name> oldNames = m_npl.getNames();
+  std::list<ndn::Name> oldNames = m_npl->getNames();
   std::list<ndn::Name> nameRefToAdd;
   std::list<PrefixInfo> namesToAdd;
 
@@ -153,8 +298,8 @@ NameLsa::update(const std::shared_ptr<Lsa>& lsa)
   std::set_difference(oldNames.begin(), oldNames.end(), newNames.begin(), newNames.end(),
                       std::inserter(nameRefToRemove, nameRefToRemove.begin()));
   for (const auto& name : nameRefToRemove) {
-    namesToRemove.push_back(m_npl.getPrefixInfoForName(name));
-    removeName(m_npl.getPrefixInfoForName(name));
+    namesToRemove.push_back(m_npl->getPrefixInfoForName(name));
+    removeName(m_npl->getPrefixInfoForName(name));
 
     updated = true;
   }
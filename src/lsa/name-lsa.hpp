@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California,
  *                           Arizona Board of Regents.
  *
@@ -36,8 +36,28 @@ namespace nlsr {
  * @code{.abnf}
  * NameLsa = NAME-LSA-TYPE TLV-LENGTH
  *             Lsa
+ *             [NameLsaShard]
  *             1*Name
  * @endcode
+ *
+ * NameLsaShard is a NonNegativeInteger that is omitted for shard 0.
+ *
+ * A NameLsa can also be encoded in a compact form, in which each prefix only carries the
+ * components that differ from the previous prefix in canonical order, and the cost only if
+ * it differs from the cost of the previous prefix (0 for the first prefix):
+ * @code{.abnf}
+ * CompactNameLsa = COMPACT-NAME-LSA-TYPE TLV-LENGTH
+ *                    Lsa
+ *                    [NameLsaShard]
+ *                    *CompactPrefixInfo
+ *
+ * CompactPrefixInfo = COMPACT-PREFIX-INFO-TYPE TLV-LENGTH
+ *                       [SharedComponents] ; number of leading components of the previous prefix
+ *                       Name               ; remaining components
+ *                       [Cost]
+ * @endcode
+ *
+ * Both forms are always decoded; the TLV type tells which one was used.
  */
 class NameLsa : public Lsa, private boost::equality_comparable<NameLsa>
 {
@@ -51,6 +71,15 @@ public:
   explicit
   NameLsa(const ndn::Block& block);
 
+  /**
+   * @brief Decode @p block, a newer version of @p previous.
+   *
+   * If @p block lists the same prefixes as @p previous in the same encoding, as it does when
+   * an LSA is refreshed, only the Lsa field is decoded and the prefix list of @p previous is
+   * shared instead of being decoded again.
+   */
+  NameLsa(const ndn::Block& block, const NameLsa& previous);
+
   Lsa::Type
   getType() const override
   {
@@ -63,30 +92,55 @@ public:
     return Lsa::Type::NAME;
   }
 
-  NamePrefixList&
-  getNpl()
+  uint32_t
+  getShard() const override
   {
-    return m_npl;
+    return m_shard;
+  }
+
+  void
+  setShard(uint32_t shard)
+  {
+    m_shard = shard;
+    m_wire.reset();
+  }
+
+  bool
+  isCompact() const
+  {
+    return m_isCompact;
+  }
+
+  /**
+   * @brief Select the compact encoding of the prefix list.
+   */
+  void
+  setCompact(bool isCompact)
+  {
+    m_isCompact = isCompact;
+    m_wire.reset();
   }
 
   const NamePrefixList&
   getNpl() const
   {
-    return m_npl;
+    return *m_npl;
   }
 
   void
   addName(const PrefixInfo& name)
   {
     m_wire.reset();
-    m_npl.insert(name);
+    unshareNpl();
+    m_npl->insert(name);
   }
 
   void
   removeName(const PrefixInfo& name)
   {
     m_wire.reset();
-    m_npl.erase(name.getName());
+    unshareNpl();
+    m_npl->erase(name.getName());
   }
 
   template<ndn::encoding::Tag TAG>
@@ -103,6 +157,20 @@ public:
   update(const std::shared_ptr<Lsa>& lsa) override;
 
 private:
+  ndn::Block::element_const_iterator
+  wireDecodeHeader(const ndn::Block& wire);
+
+  /**
+   * @brief Give this LSA its own copy of the prefix list before modifying it.
+   */
+  void
+  unshareNpl()
+  {
+    if (m_npl.use_count() > 1) {
+      m_npl = std::make_shared<NamePrefixList>(*m_npl);
+    }
+  }
+
   void
   print(std::ostream& os) const override;
 
@@ -114,11 +182,14 @@ private: // non-member operators
   friend bool
   operator==(const NameLsa& lhs, const NameLsa& rhs)
   {
-    return lhs.m_npl == rhs.m_npl;
+    return lhs.m_npl == rhs.m_npl || *lhs.m_npl == *rhs.m_npl;
   }
 
 private:
-  NamePrefixList m_npl;
+  /// Copies of an LSA share the prefix list until one of them modifies it.
+  std::shared_ptr<NamePrefixList> m_npl = std::make_shared<NamePrefixList>();
+  uint32_t m_shard = 0;
+  bool m_isCompact = false;
 };
 
 NDN_CXX_DECLARE_WIRE_ENCODE_INSTANTIATIONS(NameLsa);
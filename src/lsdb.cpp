@@ -31,9 +31,26 @@ namespace nlsr {
 
 INIT_LOGGER(Lsdb);
 
+static std::shared_ptr<Lsa>
+copyLsa(const Lsa& lsa)
+{
+  switch (lsa.getType()) {
+    case Lsa::Type::ADJACENCY:
+      return std::make_shared<AdjLsa>(static_cast<const AdjLsa&>(lsa));
+    case Lsa::Type::COORDINATE:
+      return std::make_shared<CoordinateLsa>(static_cast<const CoordinateLsa&>(lsa));
+    case Lsa::Type::NAME:
+      return std::make_shared<NameLsa>(static_cast<const NameLsa&>(lsa));
+    default:
+      NDN_THROW(std::invalid_argument("Cannot copy LSA of unknown type"));
+  }
+}
+
 Lsdb::Lsdb(ndn::Face& face, ndn::KeyChain& keyChain, ConfParameter& confParam)
   : m_face(face)
   , m_scheduler(face.getIoContext())
+  // One second resolution; a revolution covers the longest LSA refresh time
+  , m_timerWheel(m_scheduler, 1_s, 8192)
   , m_confParam(confParam)
   , m_sync(m_face, keyChain,
       SyncLogicOptions{
@@ -42,8 +59,10 @@ Lsdb::Lsdb(ndn::Face& face, ndn::KeyChain& keyChain, ConfParameter& confParam)
         confParam.getSyncUserPrefix(),
         confParam.getSyncInterestLifetime(),
         confParam.getRouterPrefix(),
-        confParam.getHyperbolicState()
+        confParam.getHyperbolicState(),
+        confParam.getNameLsaShards()
       })
+  , m_snapshot(std::make_shared<LsdbSnapshot>())
   , m_lsaRefreshTime(ndn::time::seconds(m_confParam.getLsaRefreshTime()))
   , m_adjLsaBuildInterval(m_confParam.getAdjLsaBuildInterval())
   , m_thisRouterPrefix(m_confParam.getRouterPrefix())
@@ -53,8 +72,8 @@ Lsdb::Lsdb(ndn::Face& face, ndn::KeyChain& keyChain, ConfParameter& confParam)
               const ndn::Name& originRouter, uint64_t incomingFaceId) {
         processUpdateFromSync(updateName, sequenceNumber, originRouter, incomingFaceId);
       }))
-  , m_segmenter(keyChain, m_confParam.getSigningInfo())
-  , m_segmentFifo(100)
+  , m_signingService(face.getIoContext(), keyChain, m_confParam.getSigningThreads())
+  , m_segmentCache(LSA_SEGMENT_CACHE_CAPACITY)
   , m_isBuildAdjLsaScheduled(false)
   , m_adjBuildCount(0)
 {
@@ -89,17 +108,20 @@ Lsdb::processUpdateFromSync(const ndn::Name& updateName, uint64_t seqNo,
                             const ndn::Name& originRouter, uint64_t incomingFaceId)
 {
   NLSR_LOG_DEBUG("Origin Router of update: " << originRouter << " seq: " << seqNo);
-  auto lsaType = boost::lexical_cast<Lsa::Type>(updateName.get(-1).toUri());
+  auto [lsaType, shard] = parseLsaTypeComponent(updateName.get(-1));
 
   if (originRouter == m_thisRouterPrefix) {
     NLSR_LOG_TRACE("Received sync update for own router");
     // Other routers might be telling us that they have higher sequence number
     // than what we started with because of our sequence file corruption
     // So we adapt that sequence number
-    if (isLsaNew(originRouter, lsaType, seqNo)) {
+    if (isLsaNew(originRouter, lsaType, seqNo, shard)) {
       if (lsaType == Lsa::Type::NAME) {
-        m_sequencingManager.setNameLsaSeq(seqNo);
-        buildAndInstallOwnNameLsa();
+        m_sequencingManager.setNameLsaSeq(seqNo, shard);
+        // A shard beyond the shard count is withdrawn
+        auto shards = makeNameLsaShards();
+        buildAndInstallOwnNameLsaShard(shard, shard < shards.size() ? shards[shard]
+                                                                    : NamePrefixList());
       }
       if (lsaType == Lsa::Type::ADJACENCY &&
           m_confParam.getHyperbolicState() == HYPERBOLIC_STATE_OFF) {
@@ -118,7 +140,7 @@ Lsdb::processUpdateFromSync(const ndn::Name& updateName, uint64_t seqNo,
 
   NLSR_LOG_DEBUG("Received sync update with higher " << lsaType << " sequence number than entry in LSDB");
 
-  if (isLsaNew(originRouter, lsaType, seqNo)) {
+  if (isLsaNew(originRouter, lsaType, seqNo, shard)) {
     if (lsaType == Lsa::Type::ADJACENCY && seqNo != 0 &&
         m_confParam.getHyperbolicState() == HYPERBOLIC_STATE_ON) {
       NLSR_LOG_ERROR("Got an update for adjacency LSA when hyperbolic routing "
@@ -137,18 +159,73 @@ Lsdb::processUpdateFromSync(const ndn::Name& updateName, uint64_t seqNo,
 
     ndn::Name lsaInterest{updateName};
     lsaInterest.appendNumber(seqNo);
-    expressInterest(lsaInterest, 0, incomingFaceId);
+
+    // Fetch only the changes since the version we already hold
+    std::optional<uint64_t> baseSeqNo;
+    if (lsaType == Lsa::Type::NAME && m_confParam.isNameLsaDeltaEnabled()) {
+      if (auto lsa = findLsa(originRouter, lsaType, shard); lsa) {
+        baseSeqNo = lsa->getSeqNo();
+      }
+    }
+    expressInterest(lsaInterest, 0, incomingFaceId, DEFAULT_LSA_RETRIEVAL_DEADLINE, baseSeqNo);
   }
 }
 
 void
 Lsdb::buildAndInstallOwnNameLsa()
 {
-  NameLsa nameLsa(m_thisRouterPrefix, m_sequencingManager.getNameLsaSeq() + 1,
-                  getLsaExpirationTimePoint(), m_confParam.getNamePrefixList());
-  m_sequencingManager.increaseNameLsaSeq();
+  auto shards = makeNameLsaShards();
+  for (uint32_t shard = 0; shard < shards.size(); ++shard) {
+    auto lsa = findLsa<NameLsa>(m_thisRouterPrefix, shard);
+    // Without sharding, a new version is built even if the prefixes have not changed
+    if (shards.size() == 1 || lsa == nullptr || lsa->getNpl() != shards[shard]) {
+      buildAndInstallOwnNameLsaShard(shard, shards[shard]);
+    }
+  }
+
+  // Shards left over from a larger shard count are withdrawn by a version without prefixes,
+  // which is not refreshed afterwards
+  std::vector<uint32_t> leftoverShards;
+  for (const auto& [shard, seqNo] : m_sequencingManager.getNameLsaShardSeqs()) {
+    if (shard < shards.size()) {
+      continue;
+    }
+    auto lsa = findLsa<NameLsa>(m_thisRouterPrefix, shard);
+    if (lsa == nullptr || lsa->getNpl().size() > 0) {
+      leftoverShards.push_back(shard);
+    }
+  }
+  for (auto shard : leftoverShards) {
+    NLSR_LOG_DEBUG("Withdrawing Name LSA shard " << shard);
+    buildAndInstallOwnNameLsaShard(shard, NamePrefixList());
+  }
+}
+
+std::vector<NamePrefixList>
+Lsdb::makeNameLsaShards() const
+{
+  std::vector<NamePrefixList> shards(m_confParam.getNameLsaShards());
+  if (shards.size() == 1) {
+    shards.front() = m_confParam.getNamePrefixList();
+    return shards;
+  }
+
+  for (const auto& prefixInfo : m_confParam.getNamePrefixList().getPrefixInfo()) {
+    shards[getNameLsaShard(prefixInfo.getName())].insert(prefixInfo);
+  }
+  return shards;
+}
+
+void
+Lsdb::buildAndInstallOwnNameLsaShard(uint32_t shard, const NamePrefixList& npl)
+{
+  NameLsa nameLsa(m_thisRouterPrefix, m_sequencingManager.getNameLsaSeq(shard) + 1,
+                  getLsaExpirationTimePoint(), npl);
+  nameLsa.setShard(shard);
+  nameLsa.setCompact(m_confParam.isNameLsaCompactEnabled());
+  m_sequencingManager.increaseNameLsaSeq(shard);
   m_sequencingManager.writeSeqNoToFile();
-  m_sync.publishRoutingUpdate(Lsa::Type::NAME, m_sequencingManager.getNameLsaSeq());
+  m_sync.publishRoutingUpdate(Lsa::Type::NAME, m_sequencingManager.getNameLsaSeq(shard), shard);
 
   installLsa(std::make_shared<NameLsa>(nameLsa));
 }
@@ -181,6 +258,17 @@ Lsdb::scheduleAdjLsaBuild()
     return;
   }
 
+  if (m_confParam.isAdjLsaThrottleEnabled()) {
+    // Unlike the build interval, the hold-down is not extended by further changes
+    if (!m_isBuildAdjLsaScheduled) {
+      auto delay = getAdjLsaBuildDelay();
+      NLSR_LOG_DEBUG("Scheduling Adjacency LSA build in " << delay);
+      m_isBuildAdjLsaScheduled = true;
+      m_scheduledAdjLsaBuild = m_scheduler.schedule(delay, [this] { buildAdjLsa(); });
+    }
+    return;
+  }
+
   if (m_isBuildAdjLsaScheduled) {
     NLSR_LOG_DEBUG("Rescheduling Adjacency LSA build in " << m_adjLsaBuildInterval);
   }
@@ -191,9 +279,28 @@ Lsdb::scheduleAdjLsaBuild()
   m_scheduledAdjLsaBuild = m_scheduler.schedule(m_adjLsaBuildInterval, [this] { buildAdjLsa(); });
 }
 
+ndn::time::milliseconds
+Lsdb::getAdjLsaBuildDelay()
+{
+  auto now = ndn::time::steady_clock::now();
+  auto maxHoldDown = m_confParam.getAdjLsaHoldDownMax();
+  if (m_adjLsaHoldDown == 0_ms || now - m_lastAdjLsaBuild >= 2 * maxHoldDown) {
+    m_adjLsaHoldDown = std::min(m_confParam.getAdjLsaHoldDownMin(), maxHoldDown);
+    return 0_ms;
+  }
+
+  auto earliest = m_lastAdjLsaBuild + m_adjLsaHoldDown;
+  m_adjLsaHoldDown = std::min(2 * m_adjLsaHoldDown, maxHoldDown);
+  if (earliest <= now) {
+    return 0_ms;
+  }
+  return ndn::time::duration_cast<ndn::time::milliseconds>(earliest - now);
+}
+
 void
 Lsdb::writeLog() const
 {
+  auto snapshot = getSnapshot();
   for (auto type : {Lsa::Type::COORDINATE, Lsa::Type::NAME, Lsa::Type::ADJACENCY}) {
     if ((type == Lsa::Type::COORDINATE &&
          m_confParam.getHyperbolicState() == HYPERBOLIC_STATE_OFF) ||
@@ -203,13 +310,50 @@ Lsdb::writeLog() const
     }
 
     NLSR_LOG_DEBUG("---------------" << type << " LSDB-------------------");
-    auto lsaRange = m_lsdb.get<byType>().equal_range(type);
-    for (auto lsaIt = lsaRange.first; lsaIt != lsaRange.second; ++lsaIt) {
-      NLSR_LOG_DEBUG(**lsaIt);
+    const auto& lsas = snapshot->getLsas(type);
+    for (const auto& lsa : lsas) {
+      NLSR_LOG_DEBUG(*lsa);
     }
   }
 }
 
+std::shared_ptr<const LsdbSnapshot>
+Lsdb::getSnapshot() const
+{
+  if (m_outdatedLsaTypes.none()) {
+    return m_snapshot;
+  }
+
+  auto snapshot = std::make_shared<LsdbSnapshot>(*m_snapshot);
+  snapshot->m_version = m_version;
+  snapshot->m_typeVersions = m_typeVersions;
+  for (size_t i = 0; i < m_outdatedLsaTypes.size(); ++i) {
+    if (m_outdatedLsaTypes.test(i)) {
+      auto lsaRange = m_lsdb.get<byType>().equal_range(static_cast<Lsa::Type>(i));
+      snapshot->m_lsas[i] = std::make_shared<const LsaContainer>(lsaRange.first, lsaRange.second);
+    }
+  }
+  m_outdatedLsaTypes.reset();
+  m_snapshot = std::move(snapshot);
+  return m_snapshot;
+}
+
+std::optional<std::vector<Lsdb::RemovedLsa>>
+Lsdb::getRemovedLsas(Lsa::Type lsaType, uint64_t version) const
+{
+  if (version < m_forgottenRemovalVersion) {
+    return std::nullopt;
+  }
+
+  std::vector<RemovedLsa> removed;
+  for (const auto& entry : m_removedLsas) {
+    if (entry.version > version && entry.type == lsaType) {
+      removed.push_back(entry);
+    }
+  }
+  return removed;
+}
+
 void
 Lsdb::processInterest(const ndn::Name& name, const ndn::Interest& interest)
 {
@@ -218,9 +362,9 @@ Lsdb::processInterest(const ndn::Name& name, const ndn::Interest& interest)
 
   if (interestName[-2].isVersion()) {
     // Interest for particular segment
-    auto data = m_segmentFifo.find(interestName);
+    auto data = m_segmentCache.findSegment(interestName);
     if (data) {
-      NLSR_LOG_TRACE("Replying from FIFO buffer");
+      NLSR_LOG_TRACE("Replying from segment cache");
       m_face.put(*data);
       return;
     }
@@ -230,6 +374,13 @@ Lsdb::processInterest(const ndn::Name& name, const ndn::Interest& interest)
     NLSR_LOG_TRACE("Interest w/o segment and version: " << interestName);
   }
 
+  // Interest for the changes of a Name LSA: /<LSA name>/<seqNo>/DELTA/<base seqNo>
+  std::optional<uint64_t> baseSeqNo;
+  if (interestName.size() > 2 && interestName[-2] == DELTA_COMPONENT) {
+    baseSeqNo = interestName[-1].toNumber();
+    interestName = interestName.getPrefix(-2);
+  }
+
   // increment RCV_LSA_INTEREST
   lsaIncrementSignal(Statistics::PacketType::RCV_LSA_INTEREST);
 
@@ -246,16 +397,15 @@ Lsdb::processInterest(const ndn::Name& name, const ndn::Interest& interest)
     uint64_t seqNo = interestName[-1].toNumber();
     NLSR_LOG_DEBUG("LSA sequence number from interest: " << seqNo);
 
-    std::string lsaType = interestName[-2].toUri();
-    Lsa::Type interestedLsType;
-    std::istringstream(lsaType) >> interestedLsType;
+    auto [interestedLsType, shard] = parseLsaTypeComponent(interestName[-2]);
     if (interestedLsType == Lsa::Type::BASE) {
-      NLSR_LOG_WARN("Received unrecognized LSA type: " << lsaType);
+      NLSR_LOG_WARN("Received unrecognized LSA type: " << interestName[-2].toUri());
       return;
     }
 
     incrementInterestRcvdStats(interestedLsType);
-    if (processInterestForLsa(interest, originRouter, interestedLsType, seqNo)) {
+    if (processInterestForLsa(interest, originRouter, interestedLsType, seqNo, baseSeqNo,
+                              shard)) {
       lsaIncrementSignal(Statistics::PacketType::SENT_LSA_DATA);
     }
   }
@@ -268,28 +418,26 @@ Lsdb::processInterest(const ndn::Name& name, const ndn::Interest& interest)
 
 bool
 Lsdb::processInterestForLsa(const ndn::Interest& interest, const ndn::Name& originRouter,
-                            Lsa::Type lsaType, uint64_t seqNo)
+                            Lsa::Type lsaType, uint64_t seqNo,
+                            std::optional<uint64_t> baseSeqNo, uint32_t shard)
 {
   NLSR_LOG_DEBUG(interest << " received for " << lsaType);
 
-  if (auto lsaPtr = findLsa(originRouter, lsaType); lsaPtr) {
+  if (auto lsaPtr = findLsa(originRouter, lsaType, shard); lsaPtr) {
     NLSR_LOG_TRACE("Verifying SeqNo for " << lsaType << " is same as requested");
+    if (lsaPtr->getSeqNo() == seqNo && baseSeqNo && lsaType == Lsa::Type::NAME) {
+      putNameLsaDelta(interest, static_cast<const NameLsa&>(*lsaPtr), *baseSeqNo);
+      incrementDataSentStats(lsaType);
+      return true;
+    }
     if (lsaPtr->getSeqNo() == seqNo) {
-      auto segments = m_segmenter.segment(lsaPtr->wireEncode(),
-                                          ndn::Name(interest.getName()).appendVersion(),
-                                          ndn::MAX_NDN_PACKET_SIZE / 2, m_lsaRefreshTime);
-      for (const auto& data : segments) {
-        m_segmentFifo.insert(*data, m_lsaRefreshTime);
-        m_scheduler.schedule(m_lsaRefreshTime,
-                             [this, name = data->getName()] { m_segmentFifo.erase(name); });
-      }
-
-      uint64_t segNum = 0;
-      if (interest.getName()[-1].isSegment()) {
-        segNum = interest.getName()[-1].toSegment();
+      if (auto segments = m_segmentCache.find(lsaType, shard, seqNo, lsaPtr->wireEncode());
+          segments) {
+        putLsaSegment(interest, *segments);
       }
-      if (segNum < segments.size()) {
-        m_face.put(*segments[segNum]);
+      else {
+        NLSR_LOG_TRACE("Segments of " << lsaType << " LSA are not cached");
+        segmentOwnLsa(*lsaPtr, interest);
       }
       incrementDataSentStats(lsaType);
       return true;
@@ -312,46 +460,91 @@ Lsdb::installLsa(std::shared_ptr<Lsa> lsa)
     }
   }
 
-  auto chkLsa = findLsa(lsa->getOriginRouter(), lsa->getType());
+  auto chkLsa = findLsa(lsa->getOriginRouter(), lsa->getType(), lsa->getShard());
   if (chkLsa == nullptr) {
     NLSR_LOG_DEBUG("Adding LSA:\n" << *lsa);
 
+    markModified(lsa->getType());
+    lsa->setLsdbVersion(m_version);
     m_lsdb.emplace(lsa);
     onLsdbModified(lsa, LsdbUpdate::INSTALLED, {}, {});
 
     lsa->setExpiringEventId(scheduleLsaExpiration(lsa, timeToExpire));
+    if (lsa->getOriginRouter() == m_thisRouterPrefix) {
+      if (lsa->getType() == Lsa::Type::NAME) {
+        m_ownNameLsaChanges.erase(lsa->getShard());
+      }
+      segmentOwnLsa(*lsa);
+    }
   }
   // Else this is a known name LSA, so we are updating it.
   else if (chkLsa->getSeqNo() < lsa->getSeqNo()) {
     NLSR_LOG_DEBUG("Updating LSA:\n" << *chkLsa);
-    chkLsa->setSeqNo(lsa->getSeqNo());
-    chkLsa->setExpirationTimePoint(lsa->getExpirationTimePoint());
-
-    auto [updated, namesToAdd, namesToRemove] = chkLsa->update(lsa);
+    auto newLsa = copyLsa(*chkLsa);
+    newLsa->setSeqNo(lsa->getSeqNo());
+    newLsa->setExpirationTimePoint(lsa->getExpirationTimePoint());
+
+    auto [updated, namesToAdd, namesToRemove] = newLsa->update(lsa);
+    replaceLsa(m_lsdb.get<byName>().find(std::make_tuple(lsa->getOriginRouter(), lsa->getType(),
+                                                         lsa->getShard())),
+               newLsa);
     if (updated) {
       onLsdbModified(lsa, LsdbUpdate::UPDATED, namesToAdd, namesToRemove);
     }
 
-    chkLsa->setExpiringEventId(scheduleLsaExpiration(chkLsa, timeToExpire));
-    NLSR_LOG_DEBUG("Updated LSA:\n" << *chkLsa);
+    newLsa->setExpiringEventId(scheduleLsaExpiration(newLsa, timeToExpire));
+    if (newLsa->getOriginRouter() == m_thisRouterPrefix) {
+      if (newLsa->getType() == Lsa::Type::NAME) {
+        recordOwnNameLsaChange(newLsa->getShard(), newLsa->getSeqNo(), namesToAdd,
+                               namesToRemove);
+      }
+      segmentOwnLsa(*newLsa);
+    }
+    NLSR_LOG_DEBUG("Updated LSA:\n" << *newLsa);
   }
 }
 
+void
+Lsdb::replaceLsa(const LsaContainer::index<Lsdb::byName>::type::iterator& lsaIt,
+                 std::shared_ptr<Lsa> lsa)
+{
+  // The replaced LSA may outlive its removal from the LSDB in snapshots
+  m_timerWheel.cancel((*lsaIt)->getExpiringEventId());
+  markModified(lsa->getType());
+  lsa->setLsdbVersion(m_version);
+  m_lsdb.replace(lsaIt, std::move(lsa));
+}
+
 void
 Lsdb::removeLsa(const LsaContainer::index<Lsdb::byName>::type::iterator& lsaIt)
 {
   if (lsaIt != m_lsdb.end()) {
     auto lsaPtr = *lsaIt;
     NLSR_LOG_DEBUG("Removing LSA:\n" << *lsaPtr);
+    m_timerWheel.cancel(lsaPtr->getExpiringEventId());
     m_lsdb.erase(lsaIt);
+    if (lsaPtr->getOriginRouter() == m_thisRouterPrefix) {
+      m_segmentCache.erase(lsaPtr->getType(), lsaPtr->getShard());
+      m_lsaSegmentations.erase({lsaPtr->getType(), lsaPtr->getShard()});
+      if (lsaPtr->getType() == Lsa::Type::NAME) {
+        m_ownNameLsaChanges.erase(lsaPtr->getShard());
+      }
+    }
+    markModified(lsaPtr->getType());
+    m_removedLsas.push_back({m_version, lsaPtr->getOriginRouter(), lsaPtr->getType(),
+                             lsaPtr->getShard()});
+    if (m_removedLsas.size() > REMOVED_LSA_HISTORY_SIZE) {
+      m_forgottenRemovalVersion = m_removedLsas.front().version;
+      m_removedLsas.pop_front();
+    }
     onLsdbModified(lsaPtr, LsdbUpdate::REMOVED, {}, {});
   }
 }
 
 void
-Lsdb::removeLsa(const ndn::Name& router, Lsa::Type lsaType)
+Lsdb::removeLsa(const ndn::Name& router, Lsa::Type lsaType, uint32_t shard)
 {
-  removeLsa(m_lsdb.get<byName>().find(std::make_tuple(router, lsaType)));
+  removeLsa(m_lsdb.get<byName>().find(std::make_tuple(router, lsaType, shard)));
 }
 
 void
@@ -366,10 +559,20 @@ Lsdb::buildAdjLsa()
     int adjBuildCount = m_adjBuildCount;
     // Only do the adjLsa build if there's one scheduled
     if (adjBuildCount > 0) {
+      m_lastAdjLsaBuild = ndn::time::steady_clock::now();
+      auto ownAdjLsa = findLsa<AdjLsa>(m_thisRouterPrefix);
       // It only makes sense to do the adjLsa build if we have neighbors
       if (m_confParam.getAdjacencyList().getNumOfActiveNeighbor() > 0) {
-        NLSR_LOG_DEBUG("Building and installing own Adj LSA");
-        buildAndInstallOwnAdjLsa();
+        // Under the throttle, a flapping link that came back does not produce a new version
+        if (m_confParam.isAdjLsaThrottleEnabled() && ownAdjLsa != nullptr &&
+            ownAdjLsa->getAdl() == AdjLsa(m_thisRouterPrefix, 0, {},
+                                          m_confParam.getAdjacencyList()).getAdl()) {
+          NLSR_LOG_DEBUG("Own Adj LSA is unchanged, not originating a new version");
+        }
+        else {
+          NLSR_LOG_DEBUG("Building and installing own Adj LSA");
+          buildAndInstallOwnAdjLsa();
+        }
       }
       // We have no active neighbors, meaning no one can route through
       // us.  So delete our entry in the LSDB. This prevents this
@@ -390,8 +593,11 @@ Lsdb::buildAdjLsa()
   // hopefully finished)
   else {
     m_isBuildAdjLsaScheduled = true;
-    auto schedulingTime = ndn::time::seconds(m_confParam.getInterestRetryNumber() *
-                                             m_confParam.getInterestResendTime());
+    // Under the throttle, check again after each Hello timeout rather than after all retries
+    auto schedulingTime = ndn::time::seconds(m_confParam.getInterestResendTime());
+    if (!m_confParam.isAdjLsaThrottleEnabled()) {
+      schedulingTime *= m_confParam.getInterestRetryNumber();
+    }
     m_scheduledAdjLsaBuild = m_scheduler.schedule(schedulingTime, [this] { buildAdjLsa(); });
   }
 }
@@ -413,11 +619,11 @@ Lsdb::buildAndInstallOwnAdjLsa()
   installLsa(std::make_shared<AdjLsa>(adjLsa));
 }
 
-ndn::scheduler::EventId
+util::TimerWheel::EventId
 Lsdb::scheduleLsaExpiration(std::shared_ptr<Lsa> lsa, ndn::time::seconds expTime)
 {
   NLSR_LOG_DEBUG("Scheduling expiration in: " << expTime + GRACE_PERIOD << " for " << lsa->getOriginRouter());
-  return m_scheduler.schedule(expTime + GRACE_PERIOD, [this, lsa] { expireOrRefreshLsa(lsa); });
+  return m_timerWheel.schedule(expTime + GRACE_PERIOD, [this, lsa] { expireOrRefreshLsa(lsa); });
 }
 
 void
@@ -426,7 +632,8 @@ Lsdb::expireOrRefreshLsa(std::shared_ptr<Lsa> lsa)
   NLSR_LOG_DEBUG("ExpireOrRefreshLsa called for " << lsa->getType());
   NLSR_LOG_DEBUG("OriginRouter: " << lsa->getOriginRouter() << " Seq No: " << lsa->getSeqNo());
 
-  auto lsaIt = m_lsdb.get<byName>().find(std::make_tuple(lsa->getOriginRouter(), lsa->getType()));
+  auto lsaIt = m_lsdb.get<byName>().find(std::make_tuple(lsa->getOriginRouter(), lsa->getType(),
+                                                         lsa->getShard()));
 
   // If this name LSA exists in the LSDB
   if (lsaIt != m_lsdb.end()) {
@@ -435,17 +642,35 @@ Lsdb::expireOrRefreshLsa(std::shared_ptr<Lsa> lsa)
     NLSR_LOG_DEBUG("LSA Exists with seq no: " << lsaPtr->getSeqNo());
     // If its seq no is the one we are expecting.
     if (lsaPtr->getSeqNo() == lsa->getSeqNo()) {
-      if (lsaPtr->getOriginRouter() == m_thisRouterPrefix) {
+      if (lsaPtr->getOriginRouter() == m_thisRouterPrefix &&
+          lsaPtr->getShard() >= m_confParam.getNameLsaShards()) {
+        // A withdrawn shard is left to expire at other routers
+        NLSR_LOG_DEBUG("Own withdrawn " << lsaPtr->getType() << " LSA shard "
+                       << lsaPtr->getShard() << ", so removing from LSDB");
+        m_sequencingManager.eraseNameLsaShard(lsaPtr->getShard());
+        m_sequencingManager.writeSeqNoToFile();
+        removeLsa(lsaIt);
+      }
+      else if (lsaPtr->getOriginRouter() == m_thisRouterPrefix) {
         NLSR_LOG_DEBUG("Own " << lsaPtr->getType() << " LSA, so refreshing it");
         NLSR_LOG_DEBUG("Current LSA:\n" << *lsaPtr);
-        lsaPtr->setSeqNo(lsaPtr->getSeqNo() + 1);
-        m_sequencingManager.setLsaSeq(lsaPtr->getSeqNo(), lsaPtr->getType());
-        lsaPtr->setExpirationTimePoint(getLsaExpirationTimePoint());
-        NLSR_LOG_DEBUG("Updated LSA:\n" << *lsaPtr);
+        auto newLsa = copyLsa(*lsaPtr);
+        newLsa->setSeqNo(lsaPtr->getSeqNo() + 1);
+        m_sequencingManager.setLsaSeq(newLsa->getSeqNo(), newLsa->getType(), newLsa->getShard());
+        newLsa->setExpirationTimePoint(getLsaExpirationTimePoint());
+        replaceLsa(lsaIt, newLsa);
+        NLSR_LOG_DEBUG("Updated LSA:\n" << *newLsa);
         // schedule refreshing event again
-        lsaPtr->setExpiringEventId(scheduleLsaExpiration(lsaPtr, m_lsaRefreshTime));
+        newLsa->setExpiringEventId(scheduleLsaExpiration(newLsa, m_lsaRefreshTime));
+        if (newLsa->getType() == Lsa::Type::NAME) {
+          recordOwnNameLsaChange(newLsa->getShard(), newLsa->getSeqNo(), {}, {});
+        }
+        segmentOwnLsa(*newLsa);
         m_sequencingManager.writeSeqNoToFile();
-        m_sync.publishRoutingUpdate(lsaPtr->getType(), m_sequencingManager.getLsaSeq(lsaPtr->getType()));
+        m_sync.publishRoutingUpdate(newLsa->getType(),
+                                    m_sequencingManager.getLsaSeq(newLsa->getType(),
+                                                                  newLsa->getShard()),
+                                    newLsa->getShard());
       }
       // Since we cannot refresh other router's LSAs, our only choice is to expire.
       else {
@@ -456,9 +681,171 @@ Lsdb::expireOrRefreshLsa(std::shared_ptr<Lsa> lsa)
   }
 }
 
+void
+Lsdb::segmentOwnLsa(const Lsa& lsa, std::optional<ndn::Interest> interest)
+{
+  auto type = lsa.getType();
+  auto shard = lsa.getShard();
+  auto seqNo = lsa.getSeqNo();
+  const auto& wire = lsa.wireEncode();
+
+  auto it = m_lsaSegmentations.find({type, shard});
+  if (it != m_lsaSegmentations.end() && it->second.seqNo == seqNo && it->second.wire == wire) {
+    // The same LSA is being segmented; answer the Interest once its segments are signed
+    if (interest) {
+      it->second.interests.push_back(std::move(*interest));
+    }
+    return;
+  }
+
+  LsaSegmentation& segmentation = m_lsaSegmentations[{type, shard}];
+  segmentation.seqNo = seqNo;
+  segmentation.wire = wire;
+  segmentation.interests.clear();
+  if (interest) {
+    segmentation.interests.push_back(std::move(*interest));
+  }
+
+  auto dataName = makeLsaUserPrefix(m_confParam.getSyncUserPrefix(), type, shard);
+  dataName.appendNumber(seqNo).appendVersion();
+  m_signingService.segment(wire, dataName, ndn::MAX_NDN_PACKET_SIZE / 2, m_lsaRefreshTime,
+                           m_confParam.getSigningInfo(),
+    [this, type, shard, seqNo, wire] (auto segments) {
+      afterSegmentOwnLsa(type, shard, seqNo, wire, std::move(segments));
+    });
+}
+
+void
+Lsdb::afterSegmentOwnLsa(Lsa::Type type, uint32_t shard, uint64_t seqNo, const ndn::Block& wire,
+                         LsaSegmentCache::Segments segments)
+{
+  auto it = m_lsaSegmentations.find({type, shard});
+  if (it == m_lsaSegmentations.end() || it->second.seqNo != seqNo || it->second.wire != wire) {
+    NLSR_LOG_TRACE("Segments of " << type << " LSA " << seqNo << " are outdated");
+    return;
+  }
+  auto interests = std::move(it->second.interests);
+  m_lsaSegmentations.erase(it);
+
+  if (!m_segmentCache.insert(type, shard, seqNo, wire, segments)) {
+    NLSR_LOG_WARN("Segments of " << type << " LSA exceed the segment cache capacity");
+  }
+  for (const auto& interest : interests) {
+    putLsaSegment(interest, segments);
+  }
+}
+
+void
+Lsdb::putLsaSegment(const ndn::Interest& interest, const LsaSegmentCache::Segments& segments)
+{
+  uint64_t segNum = 0;
+  if (interest.getName()[-1].isSegment()) {
+    segNum = interest.getName()[-1].toSegment();
+  }
+  if (segNum < segments.size()) {
+    m_face.put(*segments[segNum]);
+  }
+}
+
+void
+Lsdb::recordOwnNameLsaChange(uint32_t shard, uint64_t seqNo,
+                             const std::list<PrefixInfo>& namesToAdd,
+                             const std::list<PrefixInfo>& namesToRemove)
+{
+  auto& changes = m_ownNameLsaChanges[shard];
+  if (!changes.empty() && changes.back().seqNo + 1 != seqNo) {
+    // Deltas cannot span a gap in the sequence numbers
+    changes.clear();
+  }
+
+  NameLsaChange change{seqNo, namesToAdd, {}};
+  for (const auto& prefixInfo : namesToRemove) {
+    change.removed.push_back(prefixInfo.getName());
+  }
+  changes.push_back(std::move(change));
+  if (changes.size() > NAME_LSA_DELTA_HISTORY_SIZE) {
+    changes.pop_front();
+  }
+}
+
+std::optional<NameLsaDelta>
+Lsdb::makeOwnNameLsaDelta(const NameLsa& lsa, uint64_t baseSeqNo) const
+{
+  auto it = m_ownNameLsaChanges.find(lsa.getShard());
+  if (baseSeqNo >= lsa.getSeqNo() || it == m_ownNameLsaChanges.end() || it->second.empty() ||
+      it->second.front().seqNo > baseSeqNo + 1 || it->second.back().seqNo != lsa.getSeqNo()) {
+    return std::nullopt;
+  }
+  const auto& changes = it->second;
+
+  // The last change of each name since the base version: true if added, false if removed
+  std::map<ndn::Name, bool> lastChanges;
+  for (const auto& change : changes) {
+    if (change.seqNo <= baseSeqNo) {
+      continue;
+    }
+    for (const auto& prefixInfo : change.added) {
+      lastChanges[prefixInfo.getName()] = true;
+    }
+    for (const auto& name : change.removed) {
+      lastChanges[name] = false;
+    }
+  }
+
+  NameLsa added(lsa.getOriginRouter(), lsa.getSeqNo(), lsa.getExpirationTimePoint(),
+                NamePrefixList());
+  added.setShard(lsa.getShard());
+  added.setCompact(lsa.isCompact());
+  std::list<ndn::Name> removed;
+  for (const auto& [name, isAdded] : lastChanges) {
+    if (isAdded) {
+      added.addName(lsa.getNpl().getPrefixInfoForName(name));
+    }
+    else {
+      removed.push_back(name);
+    }
+  }
+  return NameLsaDelta(baseSeqNo, std::move(added), std::move(removed));
+}
+
+void
+Lsdb::putNameLsaDelta(const ndn::Interest& interest, const NameLsa& lsa, uint64_t baseSeqNo)
+{
+  // Segments of the delta that were produced for an earlier Interest
+  if (auto data = m_lsaStorage.find(interest); data) {
+    m_face.put(*data);
+    return;
+  }
+
+  // Reply with the whole LSA if the delta cannot be made or is not smaller
+  auto payload = lsa.wireEncode();
+  if (auto delta = makeOwnNameLsaDelta(lsa, baseSeqNo);
+      delta && delta->wireEncode().size() < payload.size()) {
+    payload = delta->wireEncode();
+  }
+  NLSR_LOG_DEBUG("Sending " << (payload.type() == tlv::NameLsaDelta ? "delta" : "whole LSA")
+                 << " for Name LSA " << lsa.getSeqNo() << " since " << baseSeqNo);
+
+  auto dataName = makeLsaUserPrefix(m_confParam.getSyncUserPrefix(), Lsa::Type::NAME,
+                                    lsa.getShard());
+  dataName.appendNumber(lsa.getSeqNo()).append(DELTA_COMPONENT).appendNumber(baseSeqNo);
+  dataName.appendVersion();
+  m_signingService.segment(payload, dataName, ndn::MAX_NDN_PACKET_SIZE / 2, m_lsaRefreshTime,
+                           m_confParam.getSigningInfo(),
+    [this, interest] (auto segments) {
+      for (const auto& data : segments) {
+        m_lsaStorage.insert(*data);
+        m_timerWheel.schedule(m_lsaRefreshTime,
+                              [this, name = data->getName()] { m_lsaStorage.erase(name); });
+      }
+      putLsaSegment(interest, segments);
+    });
+}
+
 void
 Lsdb::expressInterest(const ndn::Name& interestName, uint32_t timeoutCount, uint64_t incomingFaceId,
-                      ndn::time::steady_clock::time_point deadline)
+                      ndn::time::steady_clock::time_point deadline,
+                      std::optional<uint64_t> baseSeqNo)
 {
   // increment SENT_LSA_INTEREST
   lsaIncrementSignal(Statistics::PacketType::SENT_LSA_INTEREST);
@@ -484,7 +871,11 @@ Lsdb::expressInterest(const ndn::Name& interestName, uint32_t timeoutCount, uint
     return;
   }
 
-  ndn::Interest interest(interestName);
+  ndn::Name fetchName(interestName);
+  if (baseSeqNo) {
+    fetchName.append(DELTA_COMPONENT).appendNumber(*baseSeqNo);
+  }
+  ndn::Interest interest(fetchName);
   if (incomingFaceId != 0) {
     interest.setTag(std::make_shared<ndn::lp::NextHopFaceIdTag>(incomingFaceId));
   }
@@ -492,7 +883,7 @@ Lsdb::expressInterest(const ndn::Name& interestName, uint32_t timeoutCount, uint
   options.interestLifetime = m_confParam.getLsaInterestLifetime();
   options.maxTimeout = m_confParam.getLsaInterestLifetime();
 
-  NLSR_LOG_DEBUG("Fetching Data for LSA: " << interestName << " Seq number: " << seqNo);
+  NLSR_LOG_DEBUG("Fetching Data for LSA: " << fetchName << " Seq number: " << seqNo);
   auto fetcher = ndn::SegmentFetcher::start(m_face, interest, m_confParam.getValidator(), options);
 
   auto it = m_fetchers.insert(fetcher).first;
@@ -505,8 +896,8 @@ Lsdb::expressInterest(const ndn::Name& interestName, uint32_t timeoutCount, uint
     auto lsaSegment = std::make_shared<const ndn::Data>(data);
     m_lsaStorage.insert(*lsaSegment);
     // Schedule deletion of the segment
-    m_scheduler.schedule(ndn::time::seconds(LSA_REFRESH_TIME_DEFAULT),
-                         [this, name = lsaSegment->getName()] { m_lsaStorage.erase(name); });
+    m_timerWheel.schedule(ndn::time::seconds(LSA_REFRESH_TIME_DEFAULT),
+                          [this, name = lsaSegment->getName()] { m_lsaStorage.erase(name); });
   });
 
   fetcher->onComplete.connect([=] (const ndn::ConstBufferPtr& bufferPtr) {
@@ -520,9 +911,7 @@ Lsdb::expressInterest(const ndn::Name& interestName, uint32_t timeoutCount, uint
     m_fetchers.erase(it);
   });
 
-  Lsa::Type lsaType;
-  std::istringstream(interestName[-2].toUri()) >> lsaType;
-  incrementInterestSentStats(lsaType);
+  incrementInterestSentStats(parseLsaTypeComponent(interestName[-2]).first);
 }
 
 void
@@ -544,8 +933,10 @@ Lsdb::onFetchLsaError(uint32_t errorCode, const std::string& msg, const ndn::Nam
       if (errorCode == ndn::SegmentFetcher::ErrorCode::INTEREST_TIMEOUT) {
         delay = 0_s;
       }
+      // The LSA is fetched whole, whether or not the failed fetch asked for a delta
       m_scheduler.schedule(delay, std::bind(&Lsdb::expressInterest, this, interestName,
-                                            retransmitNo + 1, /*Multicast FaceID*/0, deadline));
+                                            retransmitNo + 1, /*Multicast FaceID*/0, deadline,
+                                            std::nullopt));
     }
   }
 }
@@ -579,8 +970,7 @@ Lsdb::afterFetchLsa(const ndn::ConstBufferPtr& bufferPtr, const ndn::Name& inter
     originRouter.append(interestName.getSubName(lsaPosition + 1,
                                                 interestName.size() - lsaPosition - 3));
     try {
-      Lsa::Type interestedLsType;
-      std::istringstream(interestName[-2].toUri()) >> interestedLsType;
+      auto [interestedLsType, shard] = parseLsaTypeComponent(interestName[-2]);
 
       if (interestedLsType == Lsa::Type::BASE) {
         NLSR_LOG_WARN("Received unrecognized LSA Type: " << interestName[-2].toUri());
@@ -590,14 +980,39 @@ Lsdb::afterFetchLsa(const ndn::ConstBufferPtr& bufferPtr, const ndn::Name& inter
       ndn::Block block(bufferPtr);
       if (interestedLsType == Lsa::Type::NAME) {
         lsaIncrementSignal(Statistics::PacketType::RCV_NAME_LSA_DATA);
-        if (isLsaNew(originRouter, interestedLsType, seqNo)) {
-          installLsa(std::make_shared<NameLsa>(block));
+        if (!isLsaNew(originRouter, interestedLsType, seqNo, shard)) {
+          return;
+        }
+        if (block.type() != tlv::NameLsaDelta) {
+          // A refreshed version shares the prefix list of the installed one without decoding it
+          auto previous = findLsa<NameLsa>(originRouter, shard);
+          auto lsa = previous ? std::make_shared<NameLsa>(block, *previous) :
+                                std::make_shared<NameLsa>(block);
+          if (lsa->getShard() != shard) {
+            NLSR_LOG_WARN("Name LSA of shard " << lsa->getShard() << " received for shard "
+                          << shard);
+            return;
+          }
+          installLsa(lsa);
+          return;
+        }
+
+        NameLsaDelta delta(block);
+        auto base = findLsa<NameLsa>(originRouter, shard);
+        if (base && base->getSeqNo() == delta.getBaseSeqNo()) {
+          installLsa(delta.apply(*base));
+        }
+        else {
+          NLSR_LOG_DEBUG("Base of Name LSA delta is no longer held, fetching whole LSA");
+          expressInterest(interestName, 0, 0);
         }
       }
       else if (interestedLsType == Lsa::Type::ADJACENCY) {
         lsaIncrementSignal(Statistics::PacketType::RCV_ADJ_LSA_DATA);
         if (isLsaNew(originRouter, interestedLsType, seqNo)) {
-          installLsa(std::make_shared<AdjLsa>(block));
+          auto previous = findLsa<AdjLsa>(originRouter);
+          installLsa(previous ? std::make_shared<AdjLsa>(block, *previous) :
+                                std::make_shared<AdjLsa>(block));
         }
       }
       else if (interestedLsType == Lsa::Type::COORDINATE) {
@@ -613,4 +1028,10 @@ Lsdb::afterFetchLsa(const ndn::ConstBufferPtr& bufferPtr, const ndn::Name& inter
   }
 }
 
+LsdbSnapshot::LsdbSnapshot()
+{
+  static const auto EMPTY = std::make_shared<const Lsdb::LsaContainer>();
+  m_lsas.fill(EMPTY);
+}
+
 } // namespace nlsr
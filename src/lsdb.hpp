@@ -24,19 +24,20 @@
 
 #include "communication/sync-logic-handler.hpp"
 #include "conf-parameter.hpp"
+#include "lsa-segment-cache.hpp"
 #include "lsa/lsa.hpp"
 #include "lsa/name-lsa.hpp"
+#include "lsa/name-lsa-delta.hpp"
 #include "lsa/coordinate-lsa.hpp"
 #include "lsa/adj-lsa.hpp"
+#include "security/signing-service.hpp"
 #include "sequencing-manager.hpp"
 #include "signals.hpp"
 #include "statistics.hpp"
 #include "test-access-control.hpp"
 
-#include <ndn-cxx/ims/in-memory-storage-fifo.hpp>
 #include <ndn-cxx/ims/in-memory-storage-persistent.hpp>
 #include <ndn-cxx/security/key-chain.hpp>
-#include <ndn-cxx/util/segmenter.hpp>
 #include <ndn-cxx/util/segment-fetcher.hpp>
 #include <ndn-cxx/util/signal.hpp>
 #include <ndn-cxx/util/time.hpp>
@@ -45,11 +46,24 @@
 #include <boost/multi_index/composite_key.hpp>
 #include <boost/multi_index/hashed_index.hpp>
 
+#include <array>
+#include <bitset>
+#include <deque>
+#include <map>
+#include <optional>
+#include <vector>
+
 namespace nlsr {
 
 namespace bmi = boost::multi_index;
 
 inline constexpr ndn::time::seconds GRACE_PERIOD = 10_s;
+/// Maximum total size of the cached segments of own LSAs, in bytes.
+inline constexpr size_t LSA_SEGMENT_CACHE_CAPACITY = 4 * 1024 * 1024;
+/// Number of versions of the own Name LSA whose changes are kept to answer delta requests.
+inline constexpr size_t NAME_LSA_DELTA_HISTORY_SIZE = 64;
+/// Number of removed LSAs that are remembered to answer queries for LSDB changes.
+inline constexpr size_t REMOVED_LSA_HISTORY_SIZE = 1024;
 
 enum class LsdbUpdate {
   INSTALLED,
@@ -57,6 +71,8 @@ enum class LsdbUpdate {
   REMOVED
 };
 
+class LsdbSnapshot;
+
 class Lsdb
 {
 public:
@@ -67,18 +83,39 @@ public:
   /*! \brief Returns whether the LSDB contains some LSA.
    */
   bool
-  doesLsaExist(const ndn::Name& router, Lsa::Type lsaType)
+  doesLsaExist(const ndn::Name& router, Lsa::Type lsaType, uint32_t shard = 0)
   {
-    return m_lsdb.get<byName>().find(std::make_tuple(router, lsaType)) != m_lsdb.end();
+    return m_lsdb.get<byName>().find(std::make_tuple(router, lsaType, shard)) != m_lsdb.end();
   }
 
   /*! \brief Builds a name LSA for this router and then installs it
       into the LSDB.
+
+      If the prefixes are split into several shards, only the shards whose prefixes have
+      changed are built again.
   */
   void
   buildAndInstallOwnNameLsa();
 
+  /*! \brief Returns the shard of the own name LSAs that advertises \p name.
+   */
+  uint32_t
+  getNameLsaShard(const ndn::Name& name) const
+  {
+    return std::hash<ndn::Name>{}(name) % m_confParam.getNameLsaShards();
+  }
+
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /*! \brief Splits the advertised prefixes into the shards of the own name LSAs.
+   */
+  std::vector<NamePrefixList>
+  makeNameLsaShards() const;
+
+  /*! \brief Builds a new version of one shard of the own name LSAs and installs it.
+   */
+  void
+  buildAndInstallOwnNameLsaShard(uint32_t shard, const NamePrefixList& npl);
+
   /*! \brief Builds a cor. LSA for this router and installs it into the LSDB. */
   void
   buildAndInstallOwnCoordinateLsa();
@@ -99,7 +136,11 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
                         const ndn::Name& originRouter, uint64_t incomingFaceId);
 
 public:
-  /*! \brief Schedules a build of this router's LSA. */
+  /*! \brief Schedules a build of this router's LSA.
+   *
+   *  The build is delayed by adj-lsa-build-interval, which restarts with every call, or by
+   *  the hold-down of the Adjacency LSA throttle if enabled.
+   */
   void
   scheduleAdjLsaBuild();
 
@@ -129,9 +170,9 @@ public:
 
   template<typename T>
   std::shared_ptr<T>
-  findLsa(const ndn::Name& router) const
+  findLsa(const ndn::Name& router, uint32_t shard = 0) const
   {
-    return std::static_pointer_cast<T>(findLsa(router, T::type()));
+    return std::static_pointer_cast<T>(findLsa(router, T::type(), shard));
   }
 
   struct ExtractOriginRouter
@@ -160,6 +201,13 @@ public:
     }
   };
 
+  struct shard_hash {
+    size_t
+    operator()(uint32_t shard) const {
+      return shard;
+    }
+  };
+
   struct byName{};
   struct byType{};
 
@@ -171,9 +219,10 @@ public:
         bmi::composite_key<
           Lsa,
           ExtractOriginRouter,
-          bmi::const_mem_fun<Lsa, Lsa::Type, &Lsa::getType>
+          bmi::const_mem_fun<Lsa, Lsa::Type, &Lsa::getType>,
+          bmi::const_mem_fun<Lsa, uint32_t, &Lsa::getShard>
         >,
-        bmi::composite_key_hash<name_hash, enum_class_hash>
+        bmi::composite_key_hash<name_hash, enum_class_hash, shard_hash>
       >,
       bmi::hashed_non_unique<
         bmi::tag<byType>,
@@ -191,11 +240,63 @@ public:
     return m_lsdb.get<byType>().equal_range(T::type());
   }
 
+  /*! \brief Returns a read-only snapshot of the current LSDB content.
+   *
+   *  The same snapshot is returned until the LSDB is modified. Afterwards, only the LSAs
+   *  of the modified types are collected again; the others are shared with the previous
+   *  snapshot.
+   */
+  std::shared_ptr<const LsdbSnapshot>
+  getSnapshot() const;
+
+  /*! \brief Returns the number of LSDB modifications so far.
+   */
+  uint64_t
+  getVersion() const
+  {
+    return m_version;
+  }
+
+  /*! \brief An LSA that has been removed from the LSDB. */
+  struct RemovedLsa
+  {
+    /// Version of the LSDB after the removal.
+    uint64_t version;
+    ndn::Name originRouter;
+    Lsa::Type type;
+    uint32_t shard;
+  };
+
+  /*! \brief Returns the LSAs of a type removed after an LSDB version, oldest first.
+   *
+   *  Only the latest REMOVED_LSA_HISTORY_SIZE removals are remembered.
+   *
+   *  \return std::nullopt if some removals after \p version have been forgotten
+   */
+  std::optional<std::vector<RemovedLsa>>
+  getRemovedLsas(Lsa::Type lsaType, uint64_t version) const;
+
+  /*! \brief Returns the timers of LSA expirations and cached segment evictions.
+   */
+  const util::TimerWheel&
+  getTimerWheel() const
+  {
+    return m_timerWheel;
+  }
+
+  /*! \brief Returns the service that signs LSA segments, shared with the hello protocol.
+   */
+  security::SigningService&
+  getSigningService()
+  {
+    return m_signingService;
+  }
+
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   std::shared_ptr<Lsa>
-  findLsa(const ndn::Name& router, Lsa::Type lsaType) const
+  findLsa(const ndn::Name& router, Lsa::Type lsaType, uint32_t shard = 0) const
   {
-    auto it = m_lsdb.get<byName>().find(std::make_tuple(router, lsaType));
+    auto it = m_lsdb.get<byName>().find(std::make_tuple(router, lsaType, shard));
     return it != m_lsdb.end() ? *it : nullptr;
   }
 
@@ -245,12 +346,14 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
     \param originRouter The name of the originating router.
     \param lsaType The type of the LSA.
     \param seqNo The sequence number to check.
+    \param shard The shard of the LSA.
   */
   bool
-  isLsaNew(const ndn::Name& originRouter, Lsa::Type lsaType, uint64_t seqNo) const
+  isLsaNew(const ndn::Name& originRouter, Lsa::Type lsaType, uint64_t seqNo,
+           uint32_t shard = 0) const
   {
     // Is the name in the LSDB and the supplied seq no is the highest so far
-    auto lsaPtr = findLsa(originRouter, lsaType);
+    auto lsaPtr = findLsa(originRouter, lsaType, shard);
     return lsaPtr ? lsaPtr->getSeqNo() < seqNo : true;
   }
 
@@ -260,17 +363,35 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   /*! \brief Remove a name LSA from the LSDB.
     \param router The name of the router that published the LSA to remove.
     \param lsaType The type of the LSA.
+    \param shard The shard of the LSA.
 
     This function will remove a name LSA from the LSDB by finding an
     LSA whose name matches key. This removal also causes the NPT to
     remove those name prefixes if no more LSAs advertise them.
    */
   void
-  removeLsa(const ndn::Name& router, Lsa::Type lsaType);
+  removeLsa(const ndn::Name& router, Lsa::Type lsaType, uint32_t shard = 0);
 
   void
   removeLsa(const LsaContainer::index<Lsdb::byName>::type::iterator& lsaIt);
 
+  /*! \brief Replaces an installed LSA with a modified copy.
+   *
+   *  Installed LSAs are never modified, because they may be referenced by snapshots.
+   */
+  void
+  replaceLsa(const LsaContainer::index<Lsdb::byName>::type::iterator& lsaIt,
+             std::shared_ptr<Lsa> lsa);
+
+  /*! \brief Records that LSAs of a type have been installed, updated, or removed. */
+  void
+  markModified(Lsa::Type lsaType)
+  {
+    ++m_version;
+    m_typeVersions[static_cast<size_t>(lsaType)] = m_version;
+    m_outdatedLsaTypes.set(static_cast<size_t>(lsaType));
+  }
+
   /*! \brief Attempts to construct an adj. LSA.
 
     This function will attempt to construct an adjacency LSA. An LSA
@@ -285,11 +406,22 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   void
   buildAndInstallOwnAdjLsa();
 
+  /*! \brief Returns the delay of an Adjacency LSA build scheduled now under the throttle,
+   *         and advances the hold-down.
+   *
+   *  The first build after a quiet period is not delayed. Each further one waits until the
+   *  hold-down has passed since the previous build; the hold-down starts at
+   *  adj-lsa-hold-down-min and doubles up to adj-lsa-hold-down-max. It is reset when no build
+   *  has happened for twice adj-lsa-hold-down-max.
+   */
+  ndn::time::milliseconds
+  getAdjLsaBuildDelay();
+
   /*! \brief Schedules a refresh/expire event in the scheduler.
     \param lsa The LSA.
     \param expTime How many seconds to wait before triggering the event.
    */
-  ndn::scheduler::EventId
+  util::TimerWheel::EventId
   scheduleLsaExpiration(std::shared_ptr<Lsa> lsa, ndn::time::seconds expTime);
 
   /*! \brief Either allow to expire, or refresh a name LSA.
@@ -298,13 +430,54 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   void
   expireOrRefreshLsa(std::shared_ptr<Lsa> lsa);
 
+  /*! \brief Segments and signs an own LSA, and caches its segments.
+    \param interest Interest to answer once the segments are signed.
+
+    The segments are named after a new version of the LSA. Signing may complete after this
+    function returns; if the LSA is modified in the meantime, its segments are discarded.
+   */
+  void
+  segmentOwnLsa(const Lsa& lsa, std::optional<ndn::Interest> interest = std::nullopt);
+
+  void
+  afterSegmentOwnLsa(Lsa::Type type, uint32_t shard, uint64_t seqNo, const ndn::Block& wire,
+                     LsaSegmentCache::Segments segments);
+
+  /*! \brief Sends the segment requested by \p interest, or the first one.
+   */
+  void
+  putLsaSegment(const ndn::Interest& interest, const LsaSegmentCache::Segments& segments);
+
+  /*! \brief Records the names added and removed by a new version of the own name LSA.
+   */
+  void
+  recordOwnNameLsaChange(uint32_t shard, uint64_t seqNo, const std::list<PrefixInfo>& namesToAdd,
+                         const std::list<PrefixInfo>& namesToRemove);
+
+  /*! \brief Composes the changes of the own name LSA since \p baseSeqNo.
+    \return The delta, or nullopt if the recorded changes do not reach back to \p baseSeqNo.
+   */
+  std::optional<NameLsaDelta>
+  makeOwnNameLsaDelta(const NameLsa& lsa, uint64_t baseSeqNo) const;
+
+  /*! \brief Answers an Interest for the changes of the own name LSA since \p baseSeqNo.
+
+    The whole LSA is sent instead if the delta cannot be composed or is not smaller.
+   */
+  void
+  putNameLsaDelta(const ndn::Interest& interest, const NameLsa& lsa, uint64_t baseSeqNo);
+
   bool
   processInterestForLsa(const ndn::Interest& interest, const ndn::Name& originRouter,
-                        Lsa::Type lsaType, uint64_t seqNo);
+                        Lsa::Type lsaType, uint64_t seqNo,
+                        std::optional<uint64_t> baseSeqNo = std::nullopt, uint32_t shard = 0);
 
+  /*! \param baseSeqNo If set, only the changes since this version of a name LSA are fetched.
+   */
   void
   expressInterest(const ndn::Name& interestName, uint32_t timeoutCount, uint64_t incomingFaceId,
-                  ndn::time::steady_clock::time_point deadline = DEFAULT_LSA_RETRIEVAL_DEADLINE);
+                  ndn::time::steady_clock::time_point deadline = DEFAULT_LSA_RETRIEVAL_DEADLINE,
+                  std::optional<uint64_t> baseSeqNo = std::nullopt);
 
   /*!
      \brief Error callback when SegmentFetcher fails to return an LSA
@@ -348,6 +521,9 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   }
 
 public:
+  /// Marks an Interest for the changes of a name LSA since a base version.
+  static inline const ndn::name::Component DELTA_COMPONENT{"DELTA"};
+
   ndn::signal::Signal<Lsdb, Statistics::PacketType> lsaIncrementSignal;
   ndn::signal::Signal<Lsdb, ndn::Data> afterSegmentValidatedSignal;
   using AfterLsdbModified = ndn::signal::Signal<Lsdb, std::shared_ptr<Lsa>, LsdbUpdate,
@@ -358,11 +534,22 @@ public:
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   ndn::Face& m_face;
   ndn::Scheduler m_scheduler;
+  /// Shared by LSA expiration and the eviction of cached LSA segments.
+  util::TimerWheel m_timerWheel;
   ConfParameter& m_confParam;
 
   SyncLogicHandler m_sync;
 
   LsaContainer m_lsdb;
+  uint64_t m_version = 0;
+  /// Version of the last modification of the LSAs of each type, indexed by Lsa::Type.
+  std::array<uint64_t, static_cast<size_t>(Lsa::Type::BASE)> m_typeVersions{};
+  std::deque<RemovedLsa> m_removedLsas;
+  /// Version of the latest removal that has been dropped from m_removedLsas.
+  uint64_t m_forgottenRemovalVersion = 0;
+  mutable std::shared_ptr<const LsdbSnapshot> m_snapshot;
+  /// Types whose LSAs have changed since m_snapshot was taken, indexed by Lsa::Type.
+  mutable std::bitset<static_cast<size_t>(Lsa::Type::BASE)> m_outdatedLsaTypes;
 
   ndn::time::seconds m_lsaRefreshTime;
   ndn::time::seconds m_adjLsaBuildInterval;
@@ -377,11 +564,35 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   ndn::signal::ScopedConnection m_onSyncUpdate;
 
   std::set<std::shared_ptr<ndn::SegmentFetcher>> m_fetchers;
-  ndn::Segmenter m_segmenter;
-  ndn::InMemoryStorageFifo m_segmentFifo;
+  security::SigningService m_signingService;
+  /// Signed segments of the current version of each own LSA.
+  LsaSegmentCache m_segmentCache;
+
+  /// An own LSA whose segments are being signed.
+  struct LsaSegmentation
+  {
+    uint64_t seqNo;
+    ndn::Block wire;
+    std::vector<ndn::Interest> interests;
+  };
+  std::map<std::pair<Lsa::Type, uint32_t>, LsaSegmentation> m_lsaSegmentations;
+
+  /// Names added and removed by a version of the own name LSA.
+  struct NameLsaChange
+  {
+    uint64_t seqNo;
+    std::list<PrefixInfo> added;
+    std::list<ndn::Name> removed;
+  };
+  /// Changes of the latest versions of each shard of the own name LSAs, with contiguous
+  /// sequence numbers.
+  std::map<uint32_t, std::deque<NameLsaChange>> m_ownNameLsaChanges;
 
   bool m_isBuildAdjLsaScheduled;
   int64_t m_adjBuildCount;
+  /// Hold-down of the next throttled build, or zero if the next one is the first.
+  ndn::time::milliseconds m_adjLsaHoldDown = 0_ms;
+  ndn::time::steady_clock::time_point m_lastAdjLsaBuild;
   ndn::scheduler::ScopedEventId m_scheduledAdjLsaBuild;
 
   ndn::InMemoryStoragePersistent m_lsaStorage;
@@ -390,6 +601,67 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
     ndn::time::steady_clock::time_point::min();
 };
 
+/**
+ * @brief Read-only view of the LSDB at one point in time.
+ *
+ * A snapshot is obtained from Lsdb::getSnapshot(). It shares the LSAs with the Lsdb, which
+ * replaces an LSA rather than modifying it once installed. Therefore, a snapshot does not change
+ * when the Lsdb is modified afterwards, and it can be read by another thread.
+ */
+class LsdbSnapshot
+{
+public:
+  /** @brief Creates an empty snapshot. */
+  LsdbSnapshot();
+
+  /** @brief Returns the number of LSDB modifications before this snapshot was taken. */
+  uint64_t
+  getVersion() const
+  {
+    return m_version;
+  }
+
+  /** @brief Returns the version of the last modification of the LSAs of a type. */
+  uint64_t
+  getVersion(Lsa::Type lsaType) const
+  {
+    return m_typeVersions[static_cast<size_t>(lsaType)];
+  }
+
+  template<typename T>
+  std::pair<Lsdb::LsaContainer::index<Lsdb::byType>::type::iterator,
+            Lsdb::LsaContainer::index<Lsdb::byType>::type::iterator>
+  getLsdbIterator() const
+  {
+    return getLsas(T::type()).get<Lsdb::byType>().equal_range(T::type());
+  }
+
+  template<typename T>
+  std::shared_ptr<const T>
+  findLsa(const ndn::Name& router, uint32_t shard = 0) const
+  {
+    const auto& lsas = getLsas(T::type());
+    auto it = lsas.get<Lsdb::byName>().find(std::make_tuple(router, T::type(), shard));
+    return it != lsas.end() ? std::static_pointer_cast<const T>(*it) : nullptr;
+  }
+
+private:
+  const Lsdb::LsaContainer&
+  getLsas(Lsa::Type lsaType) const
+  {
+    return *m_lsas[static_cast<size_t>(lsaType)];
+  }
+
+private:
+  uint64_t m_version = 0;
+  std::array<uint64_t, static_cast<size_t>(Lsa::Type::BASE)> m_typeVersions{};
+  /// LSAs of each type, indexed by Lsa::Type; containers of unchanged types are shared.
+  std::array<std::shared_ptr<const Lsdb::LsaContainer>,
+             static_cast<size_t>(Lsa::Type::BASE)> m_lsas;
+
+  friend class Lsdb;
+};
+
 } // namespace nlsr
 
 #endif // NLSR_LSDB_HPP
@@ -43,10 +43,10 @@ Nlsr::Nlsr(ndn::Face& face, ndn::KeyChain& keyChain, ConfParameter& confParam)
   , m_namePrefixList(confParam.getNamePrefixList())
   , m_fib(m_face, m_scheduler, m_adjacencyList, m_confParam, keyChain)
   , m_lsdb(m_face, keyChain, m_confParam)
-  , m_routingTable(m_scheduler, m_lsdb, m_confParam)
+  , m_routingTable(face.getIoContext(), m_scheduler, m_lsdb, m_confParam)
   , m_namePrefixTable(confParam.getRouterPrefix(), m_fib, m_routingTable,
                       m_routingTable.afterRoutingChange, m_lsdb.onLsdbModified)
-  , m_helloProtocol(m_face, keyChain, confParam, m_routingTable, m_lsdb)
+  , m_helloProtocol(m_face, confParam, m_routingTable, m_lsdb)
   , m_onNewLsaConnection(m_lsdb.onNewLsa.connect(
       [this] (const ndn::Name& updateName, uint64_t sequenceNumber,
               const ndn::Name& originRouter, uint64_t incomingFaceId) {
@@ -61,11 +61,13 @@ Nlsr::Nlsr(ndn::Face& face, ndn::KeyChain& keyChain, ConfParameter& confParam)
         auto it = m_adjacencyList.findAdjacent(neighbor);
         if (it != m_adjacencyList.end()) {
           m_fib.registerPrefix(m_confParam.getSyncPrefix(), it->getFaceUri(), it->getLinkCost(),
-                               ndn::time::milliseconds::max(), ndn::nfd::ROUTE_FLAG_CAPTURE, 0);
+                               ndn::time::milliseconds::max(), ndn::nfd::ROUTE_FLAG_CAPTURE);
         }
       }))
   , m_dispatcher(m_face, keyChain)
   , m_datasetHandler(m_dispatcher, m_lsdb, m_routingTable)
+  , m_notificationPublisher(m_face, m_confParam.getSigningInfo(), LOCALHOST_PREFIX, m_lsdb,
+                            m_routingTable)
   , m_controller(m_face, keyChain)
   , m_faceDatasetController(m_face, keyChain)
   , m_prefixUpdateProcessor(m_dispatcher,
@@ -104,7 +106,7 @@ Nlsr::Nlsr(ndn::Face& face, ndn::KeyChain& keyChain, ConfParameter& confParam)
 
   // Need to set direct neighbors' costs to 0 for hyperbolic routing
   if (m_confParam.getHyperbolicState() == HYPERBOLIC_STATE_ON) {
-    for (auto&& neighbor : m_adjacencyList.getAdjList()) {
+    for (auto&& neighbor : m_adjacencyList) {
       neighbor.setLinkCost(0);
     }
   }
@@ -275,7 +277,7 @@ Nlsr::processFaceDataset(const std::vector<ndn::nfd::FaceStatus>& faces)
   NLSR_LOG_DEBUG("Processing face dataset");
 
   // Iterate over each neighbor listed in nlsr.conf
-  for (auto&& adjacent : m_adjacencyList.getAdjList()) {
+  for (auto&& adjacent : m_adjacencyList) {
 
     const std::string& faceUriString = adjacent.getFaceUri().toString();
     // Check the list of FaceStatus objects we got for a match
@@ -311,11 +313,11 @@ Nlsr::registerAdjacencyPrefixes(const Adjacent& adj, ndn::time::milliseconds tim
   const ndn::Name& adjName = adj.getName();
 
   m_fib.registerPrefix(adjName, faceUri, linkCost,
-                       timeout, ndn::nfd::ROUTE_FLAG_CAPTURE, 0);
+                       timeout, ndn::nfd::ROUTE_FLAG_CAPTURE);
 
   m_fib.registerPrefix(m_confParam.getLsaPrefix(),
                        faceUri, linkCost, timeout,
-                       ndn::nfd::ROUTE_FLAG_CAPTURE, 0);
+                       ndn::nfd::ROUTE_FLAG_CAPTURE);
 }
 
 void
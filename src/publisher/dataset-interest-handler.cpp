@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2023,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California,
  *                           Arizona Board of Regents.
  *
@@ -22,6 +22,7 @@
 #include "dataset-interest-handler.hpp"
 #include "nlsr.hpp"
 #include "logger.hpp"
+#include "tlv-nlsr.hpp"
 
 #include <ndn-cxx/mgmt/nfd/control-response.hpp>
 #include <ndn-cxx/util/regex.hpp>
@@ -34,6 +35,7 @@ const ndn::PartialName ADJACENCIES_DATASET{"lsdb/adjacencies"};
 const ndn::PartialName COORDINATES_DATASET{"lsdb/coordinates"};
 const ndn::PartialName NAMES_DATASET{"lsdb/names"};
 const ndn::PartialName RT_DATASET{"routing-table"};
+const ndn::PartialName TIMERS_DATASET{"timers"};
 
 DatasetInterestHandler::DatasetInterestHandler(ndn::mgmt::Dispatcher& dispatcher,
                                                const Lsdb& lsdb,
@@ -53,17 +55,108 @@ DatasetInterestHandler::DatasetInterestHandler(ndn::mgmt::Dispatcher& dispatcher
   dispatcher.addStatusDataset(RT_DATASET,
     ndn::mgmt::makeAcceptAllAuthorization(),
     std::bind(&DatasetInterestHandler::publishRtStatus, this, _1, _2, _3));
+  dispatcher.addStatusDataset(TIMERS_DATASET,
+    ndn::mgmt::makeAcceptAllAuthorization(),
+    std::bind(&DatasetInterestHandler::publishTimerStatus, this, _1, _2, _3));
 }
 
-template <typename T>
+template<typename T>
+const DatasetInterestHandler::LsaStatusCache&
+DatasetInterestHandler::getLsaStatusCache(const LsdbSnapshot& lsdb)
+{
+  auto& cache = m_lsaStatusCaches[static_cast<size_t>(T::type())];
+  if (cache.version == lsdb.getVersion(T::type())) {
+    return cache;
+  }
+
+  cache.entries.clear();
+  auto lsaRange = lsdb.getLsdbIterator<T>();
+  for (auto lsaIt = lsaRange.first; lsaIt != lsaRange.second; ++lsaIt) {
+    cache.entries.push_back({*lsaIt, (*lsaIt)->wireEncode()});
+  }
+  cache.version = lsdb.getVersion(T::type());
+  ++m_nLsaStatusCacheFills;
+  return cache;
+}
+
+template<typename T>
 void
 DatasetInterestHandler::publishLsaStatus(const ndn::Name& topPrefix, const ndn::Interest& interest,
                                          ndn::mgmt::StatusDatasetContext& context)
 {
   NLSR_LOG_TRACE("Received interest: " << interest);
-  auto lsaRange = m_lsdb.getLsdbIterator<T>();
-  for (auto lsaIt = lsaRange.first; lsaIt != lsaRange.second; ++lsaIt) {
-    context.append((*lsaIt)->wireEncode());
+  auto lsdb = m_lsdb.getSnapshot();
+  const auto& cache = getLsaStatusCache<T>(*lsdb);
+
+  // All LSA datasets have names of the same length
+  size_t filterIndex = topPrefix.size() + NAMES_DATASET.size();
+  const auto& interestName = interest.getName();
+  if (interestName.size() <= filterIndex) {
+    for (const auto& entry : cache.entries) {
+      context.append(entry.wire);
+    }
+    context.end();
+    return;
+  }
+
+  std::optional<ndn::Name> originRouter;
+  uint64_t sinceVersion = 0;
+  try {
+    if (interestName.size() > filterIndex + 1) {
+      NDN_THROW(ndn::tlv::Error("Unexpected name components after LsdbStatusFilter"));
+    }
+    ndn::Block filter(interestName[filterIndex].value_bytes());
+    if (filter.type() != tlv::LsdbStatusFilter) {
+      NDN_THROW(ndn::tlv::Error("LsdbStatusFilter", filter.type()));
+    }
+    filter.parse();
+    for (const auto& element : filter.elements()) {
+      switch (element.type()) {
+        case ndn::tlv::Name:
+          originRouter.emplace(element);
+          break;
+        case tlv::LsdbVersion:
+          sinceVersion = ndn::readNonNegativeInteger(element);
+          break;
+        default:
+          NDN_THROW(ndn::tlv::Error("Unexpected element in LsdbStatusFilter"));
+      }
+    }
+  }
+  catch (const ndn::tlv::Error& e) {
+    NLSR_LOG_DEBUG("Malformed LSDB status filter: " << e.what());
+    context.reject(ndn::mgmt::ControlResponse(400, "Malformed LsdbStatusFilter"));
+    return;
+  }
+
+  auto removedLsas = m_lsdb.getRemovedLsas(T::type(), sinceVersion);
+  if (!removedLsas) {
+    context.reject(ndn::mgmt::ControlResponse(410, "Changes since LSDB version " +
+                                              std::to_string(sinceVersion) +
+                                              " are no longer known"));
+    return;
+  }
+
+  context.append(ndn::encoding::makeNonNegativeIntegerBlock(tlv::LsdbVersion,
+                                                            lsdb->getVersion()));
+  for (const auto& removed : *removedLsas) {
+    if (originRouter && removed.originRouter != *originRouter) {
+      continue;
+    }
+    ndn::Block wire(tlv::RemovedLsa);
+    wire.push_back(removed.originRouter.wireEncode());
+    if (removed.shard != 0) {
+      wire.push_back(ndn::encoding::makeNonNegativeIntegerBlock(tlv::NameLsaShard,
+                                                                removed.shard));
+    }
+    wire.encode();
+    context.append(wire);
+  }
+  for (const auto& entry : cache.entries) {
+    if ((!originRouter || entry.lsa->getOriginRouter() == *originRouter) &&
+        entry.lsa->getLsdbVersion() > sinceVersion) {
+      context.append(entry.wire);
+    }
   }
   context.end();
 }
@@ -77,4 +170,25 @@ DatasetInterestHandler::publishRtStatus(const ndn::Name& topPrefix, const ndn::I
   context.end();
 }
 
+void
+DatasetInterestHandler::publishTimerStatus(const ndn::Name& topPrefix,
+                                           const ndn::Interest& interest,
+                                           ndn::mgmt::StatusDatasetContext& context)
+{
+  NLSR_LOG_TRACE("Received interest: " << interest);
+  const auto& timers = m_lsdb.getTimerWheel();
+
+  ndn::Block status(tlv::TimerStatus);
+  status.push_back(ndn::encoding::makeNonNegativeIntegerBlock(tlv::NPendingTimers,
+                                                              timers.size()));
+  status.push_back(ndn::encoding::makeNonNegativeIntegerBlock(tlv::NExpiredTimers,
+                                                              timers.getNExpired()));
+  status.push_back(ndn::encoding::makeNonNegativeIntegerBlock(tlv::NCancelledTimers,
+                                                              timers.getNCancelled()));
+  status.encode();
+
+  context.append(status);
+  context.end();
+}
+
 } // namespace nlsr
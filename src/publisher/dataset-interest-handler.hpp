@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2022,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California,
  *                           Arizona Board of Regents.
  *
@@ -40,6 +40,9 @@
 #include <ndn-cxx/mgmt/dispatcher.hpp>
 #include <boost/noncopyable.hpp>
 
+#include <array>
+#include <optional>
+
 namespace nlsr {
 
 namespace dataset {
@@ -74,15 +77,57 @@ private:
                   ndn::mgmt::StatusDatasetContext& context);
 
   /*! \brief provide LSA status dataset
+   *
+   *  The dataset name may be followed by a component that carries an LsdbStatusFilter:
+   *
+   *      LsdbStatusFilter = LSDB-STATUS-FILTER-TYPE TLV-LENGTH
+   *                           [Name]          ; only LSAs of this origin router
+   *                           [LsdbVersion]   ; only changes after this LSDB version
+   *
+   *  The reply to a filtered request starts with the current LsdbVersion, followed by a
+   *  RemovedLsa (Name [NameLsaShard]) for each matching LSA removed after the requested
+   *  version, and then the matching LSAs installed or updated after it. A poller thus
+   *  passes the LsdbVersion of its previous reply to receive only what has changed.
+   *  Changes since a version whose removals are no longer remembered are rejected with
+   *  status code 410; the poller should then request the whole dataset again.
    */
   template<typename T>
   void
   publishLsaStatus(const ndn::Name& topPrefix, const ndn::Interest& interest,
                    ndn::mgmt::StatusDatasetContext& context);
 
+  /// Encoded LSAs of one type, reused until the LSAs of that type are modified.
+  struct LsaStatusCache
+  {
+    struct Entry
+    {
+      std::shared_ptr<const Lsa> lsa;
+      ndn::Block wire;
+    };
+
+    /// Version of the last modification of the LSAs, or std::nullopt if not filled yet.
+    std::optional<uint64_t> version;
+    std::vector<Entry> entries;
+  };
+
+  template<typename T>
+  const LsaStatusCache&
+  getLsaStatusCache(const LsdbSnapshot& lsdb);
+
+  /*! \brief provide timer status dataset
+   */
+  void
+  publishTimerStatus(const ndn::Name& topPrefix, const ndn::Interest& interest,
+                     ndn::mgmt::StatusDatasetContext& context);
+
 private:
   const Lsdb& m_lsdb;
   const RoutingTable& m_routingTable;
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /// Indexed by Lsa::Type.
+  std::array<LsaStatusCache, static_cast<size_t>(Lsa::Type::BASE)> m_lsaStatusCaches;
+  uint64_t m_nLsaStatusCacheFills = 0;
 };
 
 } // namespace nlsr
@@ -0,0 +1,201 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "notification-publisher.hpp"
+#include "logger.hpp"
+#include "tlv-nlsr.hpp"
+
+#include <algorithm>
+
+namespace nlsr {
+
+INIT_LOGGER(NotificationPublisher);
+
+const ndn::PartialName LSDB_EVENTS_STREAM{"events/lsdb"};
+const ndn::PartialName ROUTING_TABLE_EVENTS_STREAM{"events/routing-table"};
+/// Largest encoding of a RoutingTableEvent with several entries.
+constexpr size_t MAX_ROUTING_TABLE_EVENT_SIZE = ndn::MAX_NDN_PACKET_SIZE / 2;
+
+static ndn::Block
+encodeRoutingTableEntry(const RoutingTableEntry& entry)
+{
+  // Not RoutingTableEntry::wireEncode(), whose cached encoding is not reset when the next hops
+  // of an entry are modified
+  ndn::EncodingBuffer buffer;
+  entry.wireEncode(buffer);
+  return buffer.block();
+}
+
+NotificationStream::NotificationStream(ndn::Face& face, security::SigningService& signingService,
+                                       const ndn::security::SigningInfo& signingInfo,
+                                       const ndn::Name& streamName, size_t backlogSize)
+  : m_face(face)
+  , m_signingService(signingService)
+  , m_signingInfo(signingInfo)
+  , m_streamName(streamName)
+  , m_backlogSize(backlogSize)
+  , m_interestFilter(m_face.setInterestFilter(streamName,
+      [this] (const auto&, const auto& interest) { processInterest(interest); }))
+{
+  BOOST_ASSERT(backlogSize > 0);
+}
+
+void
+NotificationStream::post(const ndn::Block& notification)
+{
+  auto data = std::make_shared<ndn::Data>(ndn::Name(m_streamName)
+                                            .appendSequenceNumber(m_nextSeqNo));
+  data->setContent(notification);
+  data->setFreshnessPeriod(1_s);
+  uint64_t seqNo = m_nextSeqNo++;
+
+  m_backlog.push_back(nullptr);
+  if (m_backlog.size() > m_backlogSize) {
+    m_backlog.pop_front();
+  }
+
+  // Notifications signed on several worker threads may complete out of order
+  auto onSigned = [this, seqNo, isAlive = std::weak_ptr<bool>(m_isAlive)] (const auto& signedData) {
+    if (isAlive.expired()) {
+      return;
+    }
+    uint64_t firstSeqNo = m_nextSeqNo - m_backlog.size();
+    if (seqNo >= firstSeqNo) {
+      m_backlog[seqNo - firstSeqNo] = signedData;
+    }
+    // A subscriber may be waiting for this notification already
+    m_face.put(*signedData);
+  };
+  m_signingService.sign(std::move(data), m_signingInfo, std::move(onSigned));
+}
+
+void
+NotificationStream::processInterest(const ndn::Interest& interest)
+{
+  const auto& name = interest.getName();
+  if (m_backlog.empty()) {
+    return;
+  }
+
+  if (name.size() == m_streamName.size()) {
+    if (interest.getCanBePrefix()) {
+      // The latest notification that has been signed
+      auto latest = std::find_if(m_backlog.rbegin(), m_backlog.rend(),
+                                 [] (const auto& data) { return data != nullptr; });
+      if (latest != m_backlog.rend()) {
+        m_face.put(**latest);
+      }
+    }
+    return;
+  }
+
+  if (name.size() != m_streamName.size() + 1 || !name[-1].isSequenceNumber()) {
+    return;
+  }
+  uint64_t seqNo = name[-1].toSequenceNumber();
+  uint64_t firstSeqNo = m_nextSeqNo - m_backlog.size();
+  if (seqNo >= firstSeqNo && seqNo < m_nextSeqNo && m_backlog[seqNo - firstSeqNo] != nullptr) {
+    m_face.put(*m_backlog[seqNo - firstSeqNo]);
+  }
+  // A future or unsigned notification is sent when it has been signed; a forgotten one is never
+  // sent, and the subscriber starts over from the latest notification
+}
+
+NotificationPublisher::NotificationPublisher(ndn::Face& face,
+                                             const ndn::security::SigningInfo& signingInfo,
+                                             const ndn::Name& topPrefix, Lsdb& lsdb,
+                                             RoutingTable& routingTable)
+  : m_lsdb(lsdb)
+  , m_lsdbEvents(face, lsdb.getSigningService(), signingInfo,
+                 ndn::Name(topPrefix).append(LSDB_EVENTS_STREAM), NOTIFICATION_BACKLOG_SIZE)
+  , m_routingTableEvents(face, lsdb.getSigningService(), signingInfo,
+                         ndn::Name(topPrefix).append(ROUTING_TABLE_EVENTS_STREAM),
+                         NOTIFICATION_BACKLOG_SIZE)
+  , m_afterLsdbModified(lsdb.onLsdbModified.connect(
+      [this] (std::shared_ptr<Lsa> lsa, LsdbUpdate updateType, const auto&, const auto&) {
+        publishLsdbEvent(*lsa, updateType);
+      }))
+  , m_afterRoutingChange(routingTable.afterRoutingChange.connect(
+      [this] (const std::list<RoutingTableEntry>& entries) {
+        publishRoutingTableEvents(entries);
+      }))
+{
+}
+
+void
+NotificationPublisher::publishLsdbEvent(const Lsa& lsa, LsdbUpdate updateType)
+{
+  ndn::Block event(tlv::LsdbEvent);
+  event.push_back(ndn::encoding::makeNonNegativeIntegerBlock(tlv::LsdbEventKind,
+                                                             static_cast<uint64_t>(updateType)));
+  event.push_back(ndn::encoding::makeNonNegativeIntegerBlock(tlv::LsdbVersion,
+                                                             m_lsdb.getVersion()));
+  event.push_back(lsa.getOriginRouter().wireEncode());
+  event.push_back(ndn::encoding::makeNonNegativeIntegerBlock(tlv::LsaType,
+                                                             static_cast<uint64_t>(lsa.getType())));
+  if (lsa.getShard() != 0) {
+    event.push_back(ndn::encoding::makeNonNegativeIntegerBlock(tlv::NameLsaShard,
+                                                               lsa.getShard()));
+  }
+  event.push_back(ndn::encoding::makeNonNegativeIntegerBlock(tlv::SequenceNumber,
+                                                             lsa.getSeqNo()));
+  event.encode();
+
+  NLSR_LOG_TRACE("Publishing LSDB event " << m_lsdbEvents.getNextSeqNo() << " for "
+                 << lsa.getOriginRouter() << " " << lsa.getType());
+  m_lsdbEvents.post(event);
+}
+
+void
+NotificationPublisher::publishRoutingTableEvents(const std::list<RoutingTableEntry>& entries)
+{
+  std::vector<ndn::Block> changes;
+  std::map<ndn::Name, NexthopList> routes;
+  for (const auto& entry : entries) {
+    auto it = m_routes.find(entry.getDestination());
+    if (it == m_routes.end() || !(it->second == entry.getNexthopList())) {
+      changes.push_back(encodeRoutingTableEntry(entry));
+    }
+    routes.emplace(entry.getDestination(), entry.getNexthopList());
+  }
+  for (const auto& [destination, nexthops] : m_routes) {
+    if (routes.count(destination) == 0) {
+      changes.push_back(encodeRoutingTableEntry(RoutingTableEntry(destination)));
+    }
+  }
+  m_routes = std::move(routes);
+
+  auto change = changes.begin();
+  while (change != changes.end()) {
+    ndn::Block event(tlv::RoutingTableEvent);
+    size_t size = 0;
+    do {
+      size += change->size();
+      event.push_back(*change++);
+    } while (change != changes.end() && size + change->size() <= MAX_ROUTING_TABLE_EVENT_SIZE);
+    event.encode();
+
+    NLSR_LOG_TRACE("Publishing routing table event " << m_routingTableEvents.getNextSeqNo());
+    m_routingTableEvents.post(event);
+  }
+}
+
+} // namespace nlsr
@@ -0,0 +1,156 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NLSR_PUBLISHER_NOTIFICATION_PUBLISHER_HPP
+#define NLSR_PUBLISHER_NOTIFICATION_PUBLISHER_HPP
+
+#include "lsdb.hpp"
+#include "route/nexthop-list.hpp"
+#include "route/routing-table.hpp"
+#include "security/signing-service.hpp"
+#include "test-access-control.hpp"
+
+#include <ndn-cxx/face.hpp>
+
+#include <boost/noncopyable.hpp>
+
+#include <deque>
+#include <map>
+
+namespace nlsr {
+
+/// Number of the latest notifications of each stream that can be retrieved.
+inline constexpr size_t NOTIFICATION_BACKLOG_SIZE = 256;
+
+/*!
+   \brief Publishes sequence-numbered notifications, keeping the latest ones.
+
+   Notification n is published as a Data packet named <stream name>/seq=n, following the
+   convention of NFD notification streams, so that ndn::util::NotificationSubscriber can
+   subscribe to it. An Interest for the stream name itself retrieves the latest notification.
+   A subscriber that fell behind can catch up as long as the notifications it missed are
+   among the latest \p backlogSize ones.
+
+   Notifications are signed by the SigningService, possibly on worker threads, and each one
+   is published once it has been signed.
+ */
+class NotificationStream : boost::noncopyable
+{
+public:
+  NotificationStream(ndn::Face& face, security::SigningService& signingService,
+                     const ndn::security::SigningInfo& signingInfo,
+                     const ndn::Name& streamName, size_t backlogSize);
+
+  void
+  post(const ndn::Block& notification);
+
+  const ndn::Name&
+  getName() const
+  {
+    return m_streamName;
+  }
+
+  /*! \brief Returns the sequence number of the next notification.
+   */
+  uint64_t
+  getNextSeqNo() const
+  {
+    return m_nextSeqNo;
+  }
+
+private:
+  void
+  processInterest(const ndn::Interest& interest);
+
+private:
+  ndn::Face& m_face;
+  security::SigningService& m_signingService;
+  const ndn::security::SigningInfo m_signingInfo;
+  const ndn::Name m_streamName;
+  const size_t m_backlogSize;
+
+  /// The latest notifications, ending with the one numbered m_nextSeqNo - 1; nullptr for
+  /// those that are not signed yet.
+  std::deque<std::shared_ptr<const ndn::Data>> m_backlog;
+  uint64_t m_nextSeqNo = 0;
+  ndn::ScopedInterestFilterHandle m_interestFilter;
+  /// Expires when this stream is destroyed; checked by notifications signed afterwards, as the
+  /// SigningService may outlive the stream.
+  std::shared_ptr<bool> m_isAlive = std::make_shared<bool>(true);
+};
+
+/*!
+   \brief Publishes LSDB changes and routing table changes as notification streams.
+
+   Each LsdbEvent identifies an LSA that has been installed, updated, or removed, and the
+   version of the LSDB after the change. Its content can be retrieved with the LSA status
+   datasets, by asking for the changes since the version preceding the event:
+
+       LsdbEvent = LSDB-EVENT-TYPE TLV-LENGTH
+                     LsdbEventKind      ; LsdbUpdate
+                     LsdbVersion
+                     Name               ; origin router
+                     LsaType            ; Lsa::Type
+                     [NameLsaShard]
+                     SequenceNumber
+
+   LSAs that are only refreshed do not produce an event.
+
+   Each RoutingTableEvent carries the routing table entries whose next hops have changed
+   since the previous calculation; an entry without next hops is a destination that is no
+   longer reachable. A change too large for one notification is split into several ones.
+
+       RoutingTableEvent = ROUTING-TABLE-EVENT-TYPE TLV-LENGTH
+                             1*RoutingTableEntry
+ */
+class NotificationPublisher : boost::noncopyable
+{
+public:
+  /*! \brief Notifications are signed by the SigningService of \p lsdb.
+   */
+  NotificationPublisher(ndn::Face& face, const ndn::security::SigningInfo& signingInfo,
+                        const ndn::Name& topPrefix, Lsdb& lsdb, RoutingTable& routingTable);
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  void
+  publishLsdbEvent(const Lsa& lsa, LsdbUpdate updateType);
+
+  void
+  publishRoutingTableEvents(const std::list<RoutingTableEntry>& entries);
+
+private:
+  const Lsdb& m_lsdb;
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  NotificationStream m_lsdbEvents;
+  NotificationStream m_routingTableEvents;
+
+private:
+  /// Next hops of each destination as of the previous routing table calculation.
+  std::map<ndn::Name, NexthopList> m_routes;
+
+  ndn::signal::ScopedConnection m_afterLsdbModified;
+  ndn::signal::ScopedConnection m_afterRoutingChange;
+};
+
+} // namespace nlsr
+
+#endif // NLSR_PUBLISHER_NOTIFICATION_PUBLISHER_HPP
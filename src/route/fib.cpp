@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California
  *
  * This file is part of NLSR (Named-data Link State Routing).
@@ -25,10 +25,12 @@
 #include "nexthop-list.hpp"
 
 #include <ndn-cxx/mgmt/nfd/control-command.hpp>
+#include <ndn-cxx/util/random.hpp>
 
 #include <algorithm>
 #include <cmath>
 #include <map>
+#include <random>
 
 namespace nlsr {
 
@@ -41,6 +43,7 @@ Fib::Fib(ndn::Face& face, ndn::Scheduler& scheduler, AdjacencyList& adjacencyLis
   , m_controller(face, keyChain)
   , m_adjacencyList(adjacencyList)
   , m_confParameter(conf)
+  , m_lastRefreshRefill(ndn::time::steady_clock::now())
 {
 }
 
@@ -65,11 +68,30 @@ Fib::addNextHopsToFibEntryAndNfd(FibEntry& entry, const NextHopsUriSortedSet& ho
   const ndn::Name& name = entry.name;
 
   bool shouldRegister = isNotNeighbor(name);
+  // A change of flags applies to all next hops
+  bool haveFlagsChanged = entry.routeFlags != routeFlags;
+  entry.routeFlags = routeFlags;
 
   for (const auto& hop : hopsToAdd)
   {
-    // Add nexthop to FIB entry
-    NLSR_LOG_DEBUG("Adding " << hop.getConnectingFaceUri() << " to " << entry.name);
+    // The set is sorted by face URI only, so this finds the installed next hop on the same face
+    auto installed = entry.nexthopSet.getNextHops().find(hop);
+    if (installed != entry.nexthopSet.end()) {
+      if (*installed == hop && !haveFlagsChanged &&
+          entry.abandonedFaceUris.count(hop.getConnectingFaceUri()) == 0) {
+        // Already registered with the same cost; the periodic refresh keeps it alive
+        if (shouldRegister) {
+          ++m_ribCommandCounters.nSuppressed;
+        }
+        continue;
+      }
+      NLSR_LOG_DEBUG("Updating cost of " << hop.getConnectingFaceUri() << " for " << entry.name <<
+                     " from " << installed->getRouteCost() << " to " << hop.getRouteCost());
+      entry.nexthopSet.removeNextHop(NextHop(*installed));
+    }
+    else {
+      NLSR_LOG_DEBUG("Adding " << hop.getConnectingFaceUri() << " to " << entry.name);
+    }
     entry.nexthopSet.addNextHop(hop);
 
     if (shouldRegister) {
@@ -77,7 +99,7 @@ Fib::addNextHopsToFibEntryAndNfd(FibEntry& entry, const NextHopsUriSortedSet& ho
       registerPrefix(name, ndn::FaceUri(hop.getConnectingFaceUri()),
                      hop.getRouteCostAsAdjustedInteger(),
                      ndn::time::seconds(m_refreshTime + GRACE_PERIOD),
-                     routeFlags, 0);
+                     routeFlags);
     }
   }
 }
@@ -139,6 +161,7 @@ Fib::update(const ndn::Name& name, const NexthopList& allHops, uint64_t routeFla
       }
       NLSR_LOG_DEBUG("Removing " << hop.getConnectingFaceUri() << " from " << entry.name);
       entry.nexthopSet.removeNextHop(hop);
+      entry.abandonedFaceUris.erase(hop.getConnectingFaceUri());
     }
 
     // Increment sequence number
@@ -147,10 +170,9 @@ Fib::update(const ndn::Name& name, const NexthopList& allHops, uint64_t routeFla
   }
 
   if (entryIt != m_table.end() &&
-      !entryIt->second.refreshEventId &&
+      !entryIt->second.refreshTime &&
       isNotNeighbor(entryIt->second.name)) {
-    scheduleEntryRefresh(entryIt->second, routeFlags,
-                         [this] (FibEntry& entry, uint64_t routeFlags) { scheduleLoop(entry, routeFlags); });
+    scheduleEntryRefresh(entryIt->second, routeFlags);
   }
 }
 
@@ -173,28 +195,26 @@ Fib::isNotNeighbor(const ndn::Name& name)
 void
 Fib::registerPrefix(const ndn::Name& namePrefix, const ndn::FaceUri& faceUri,
                     uint64_t faceCost, const ndn::time::milliseconds& timeout,
-                    uint64_t flags, uint8_t times)
+                    uint64_t flags)
 {
-  uint64_t faceId = m_adjacencyList.getFaceId(faceUri);
-
-  if (faceId > 0) {
-    ndn::nfd::ControlParameters faceParameters;
-    faceParameters
-     .setName(namePrefix)
-     .setFaceId(faceId)
-     .setFlags(flags)
-     .setCost(faceCost)
-     .setExpirationPeriod(timeout)
-     .setOrigin(ndn::nfd::ROUTE_ORIGIN_NLSR);
-
-    NLSR_LOG_DEBUG("Registering prefix: " << faceParameters.getName() << " faceUri: " << faceUri);
-    m_controller.start<ndn::nfd::RibRegisterCommand>(faceParameters,
-      std::bind(&Fib::onRegistrationSuccess, this, _1, faceUri),
-      std::bind(&Fib::onRegistrationFailure, this, _1, faceParameters, faceUri, times));
-  }
-  else {
-    NLSR_LOG_WARN("Error: No Face Id for face uri: " << faceUri);
-  }
+  enqueueRegistration(namePrefix, faceUri, faceCost, timeout, flags, false);
+}
+
+void
+Fib::enqueueRegistration(const ndn::Name& namePrefix, const ndn::FaceUri& faceUri,
+                         uint64_t faceCost, const ndn::time::milliseconds& timeout,
+                         uint64_t flags, bool isRefresh)
+{
+  ndn::nfd::ControlParameters faceParameters;
+  faceParameters
+   .setName(namePrefix)
+   .setFlags(flags)
+   .setCost(faceCost)
+   .setExpirationPeriod(timeout)
+   .setOrigin(ndn::nfd::ROUTE_ORIGIN_NLSR);
+
+  NLSR_LOG_DEBUG("Registering prefix: " << namePrefix << " faceUri: " << faceUri);
+  enqueueRibCommand({true, isRefresh, faceParameters, faceUri});
 }
 
 void
@@ -208,59 +228,225 @@ Fib::onRegistrationSuccess(const ndn::nfd::ControlParameters& param,
   if (adjacent != m_adjacencyList.end()) {
     adjacent->setFaceId(param.getFaceId());
   }
+
+  auto entry = m_table.find(param.getName());
+  if (entry != m_table.end()) {
+    entry->second.abandonedFaceUris.erase(faceUri);
+  }
   onPrefixRegistrationSuccess(param.getName());
 }
 
 void
-Fib::onRegistrationFailure(const ndn::nfd::ControlResponse& response,
-                           const ndn::nfd::ControlParameters& parameters,
-                           const ndn::FaceUri& faceUri,
-                           uint8_t times)
+Fib::onRegistrationFailure(const ndn::nfd::ControlResponse& response, RibCommand command)
 {
   NLSR_LOG_DEBUG("Failed in name registration: " << response.getText() <<
                  " (code: " << response.getCode() << ")");
-  NLSR_LOG_DEBUG("Prefix: " << parameters.getName() << " failed for: " << +times);
-  if (times < 3) {
-    NLSR_LOG_DEBUG("Trying to register again...");
-    registerPrefix(parameters.getName(), faceUri,
-                   parameters.getCost(),
-                   parameters.getExpirationPeriod(),
-                   parameters.getFlags(), times+1);
+  NLSR_LOG_DEBUG("Prefix: " << command.parameters.getName() <<
+                 " failed for: " << +command.nRetries);
+
+  // A later command for the same prefix and face has been queued meanwhile
+  if (isSuperseded(command)) {
+    NLSR_LOG_DEBUG("Not retrying the superseded registration");
+    ++m_ribCommandCounters.nSuperseded;
+    releaseRibCommand(command);
+    return;
+  }
+
+  if (command.nRetries < RIB_COMMAND_MAX_RETRIES) {
+    auto& state = m_ribCommandKeys.at({command.parameters.getName(), command.faceUri});
+    if (state.retrySeqNo > command.seqNo) {
+      // A later command is waiting to be retried already
+      ++m_ribCommandCounters.nSuperseded;
+      releaseRibCommand(command);
+      return;
+    }
+    if (state.retrySeqNo != 0) {
+      // The retry of an earlier command is replaced by this one
+      ++m_ribCommandCounters.nSuperseded;
+      --state.nOutstanding;
+    }
+
+    auto backoff = RIB_COMMAND_INITIAL_BACKOFF * (1 << command.nRetries);
+    NLSR_LOG_DEBUG("Trying to register again in " << backoff);
+    ++command.nRetries;
+    ++m_ribCommandCounters.nRetried;
+    state.retrySeqNo = command.seqNo;
+    state.retryEvent = m_scheduler.schedule(backoff, [this, command = std::move(command)] {
+      m_ribCommandKeys.at({command.parameters.getName(), command.faceUri}).retrySeqNo = 0;
+      queueRibCommand(command);
+    });
   }
   else {
     NLSR_LOG_DEBUG("Registration trial given up");
+    ++m_ribCommandCounters.nAbandoned;
+    releaseRibCommand(command);
+
+    // NFD may not have the next hop, so that the next update registers it again
+    auto entry = m_table.find(command.parameters.getName());
+    if (entry != m_table.end()) {
+      const auto& hops = entry->second.nexthopSet;
+      auto hop = std::find_if(hops.begin(), hops.end(), [&] (const NextHop& nh) {
+        return nh.getConnectingFaceUri() == command.faceUri;
+      });
+      if (hop != hops.end() &&
+          hop->getRouteCostAsAdjustedInteger() == command.parameters.getCost()) {
+        entry->second.abandonedFaceUris.insert(command.faceUri);
+      }
+    }
   }
 }
 
 void
 Fib::unregisterPrefix(const ndn::Name& namePrefix, const ndn::FaceUri& faceUri)
 {
-  uint64_t faceId = 0;
-  auto adjacent = m_adjacencyList.findAdjacent(faceUri);
-  if (adjacent != m_adjacencyList.end()) {
-    faceId = adjacent->getFaceId();
+  NLSR_LOG_DEBUG("Unregister prefix: " << namePrefix << " Face Uri: " << faceUri);
+
+  ndn::nfd::ControlParameters controlParameters;
+  controlParameters
+    .setName(namePrefix)
+    .setOrigin(ndn::nfd::ROUTE_ORIGIN_NLSR);
+
+  enqueueRibCommand({false, false, controlParameters, faceUri});
+}
+
+void
+Fib::enqueueRibCommand(RibCommand command)
+{
+  command.seqNo = ++m_lastRibCommandSeqNo;
+  auto& state = m_ribCommandKeys[{command.parameters.getName(), command.faceUri}];
+  ++state.nOutstanding;
+
+  if (!command.isRefresh) {
+    // Queued refreshes of this prefix and face are dropped when they reach the front
+    state.latestSeqNo = command.seqNo;
+    if (state.retrySeqNo != 0) {
+      state.retryEvent.cancel();
+      state.retrySeqNo = 0;
+      --state.nOutstanding;
+      ++m_ribCommandCounters.nSuperseded;
+    }
   }
 
-  NLSR_LOG_DEBUG("Unregister prefix: " << namePrefix << " Face Uri: " << faceUri);
-  if (faceId > 0) {
-    ndn::nfd::ControlParameters controlParameters;
-    controlParameters
-      .setName(namePrefix)
-      .setFaceId(faceId)
-      .setOrigin(ndn::nfd::ROUTE_ORIGIN_NLSR);
-
-    m_controller.start<ndn::nfd::RibUnregisterCommand>(controlParameters,
-      [] (const ndn::nfd::ControlParameters& commandSuccessResult) {
+  queueRibCommand(std::move(command));
+}
+
+void
+Fib::queueRibCommand(RibCommand command)
+{
+  auto& queue = command.isRefresh ? m_refreshCommands : m_newCommands;
+  queue.push_back(std::move(command));
+  m_ribCommandCounters.maxQueueSize = std::max(m_ribCommandCounters.maxQueueSize,
+                                               getRibCommandQueueSize());
+  dispatchRibCommands();
+}
+
+void
+Fib::dispatchRibCommands()
+{
+  while (m_nInFlightCommands < m_confParameter.getRibCommandWindow()) {
+    auto& queue = m_newCommands.empty() ? m_refreshCommands : m_newCommands;
+    if (queue.empty()) {
+      return;
+    }
+    RibCommand command = std::move(queue.front());
+    queue.pop_front();
+    if (command.isRefresh && isSuperseded(command)) {
+      NLSR_LOG_DEBUG("Dropping superseded refresh of " << command.parameters.getName() <<
+                     " Face Uri: " << command.faceUri);
+      ++m_ribCommandCounters.nSuperseded;
+      releaseRibCommand(command);
+      continue;
+    }
+    sendRibCommand(std::move(command));
+  }
+}
+
+bool
+Fib::isSuperseded(const RibCommand& command) const
+{
+  auto it = m_ribCommandKeys.find({command.parameters.getName(), command.faceUri});
+  return it != m_ribCommandKeys.end() && it->second.latestSeqNo > command.seqNo;
+}
+
+void
+Fib::releaseRibCommand(const RibCommand& command)
+{
+  auto it = m_ribCommandKeys.find({command.parameters.getName(), command.faceUri});
+  if (it != m_ribCommandKeys.end() && --it->second.nOutstanding == 0) {
+    m_ribCommandKeys.erase(it);
+  }
+}
+
+void
+Fib::sendRibCommand(RibCommand command)
+{
+  // The face may have changed while the command was waiting in the queue
+  uint64_t faceId = m_adjacencyList.getFaceId(command.faceUri);
+  if (faceId == 0) {
+    if (command.isRegister) {
+      NLSR_LOG_WARN("Error: No Face Id for face uri: " << command.faceUri);
+    }
+    releaseRibCommand(command);
+    return;
+  }
+  command.parameters.setFaceId(faceId);
+
+  ++m_nInFlightCommands;
+  ++m_ribCommandCounters.nSent;
+  auto sentTime = ndn::time::steady_clock::now();
+
+  if (command.isRegister) {
+    auto parameters = command.parameters;
+    m_controller.start<ndn::nfd::RibRegisterCommand>(parameters,
+      [this, sentTime, command] (const ndn::nfd::ControlParameters& result) {
+        ++m_ribCommandCounters.nSucceeded;
+        releaseRibCommand(command);
+        finishRibCommand(sentTime, true);
+        onRegistrationSuccess(result, command.faceUri);
+      },
+      [this, sentTime, command] (const ndn::nfd::ControlResponse& response) {
+        ++m_ribCommandCounters.nFailed;
+        finishRibCommand(sentTime, response.getCode() != ndn::nfd::Controller::ERROR_TIMEOUT);
+        onRegistrationFailure(response, command);
+      });
+  }
+  else {
+    m_controller.start<ndn::nfd::RibUnregisterCommand>(command.parameters,
+      [this, sentTime, command] (const ndn::nfd::ControlParameters& commandSuccessResult) {
         NLSR_LOG_DEBUG("Unregister successful Prefix: " << commandSuccessResult.getName() <<
                        " Face Id: " << commandSuccessResult.getFaceId());
+        ++m_ribCommandCounters.nSucceeded;
+        releaseRibCommand(command);
+        finishRibCommand(sentTime, true);
       },
-      [] (const ndn::nfd::ControlResponse& response) {
+      [this, sentTime, command] (const ndn::nfd::ControlResponse& response) {
         NLSR_LOG_DEBUG("Failed in unregistering name: " << response.getText() <<
                        " (code " << response.getCode() << ")");
+        ++m_ribCommandCounters.nFailed;
+        releaseRibCommand(command);
+        finishRibCommand(sentTime, response.getCode() != ndn::nfd::Controller::ERROR_TIMEOUT);
       });
   }
 }
 
+void
+Fib::finishRibCommand(const ndn::time::steady_clock::time_point& sentTime, bool hasResponse)
+{
+  --m_nInFlightCommands;
+
+  if (hasResponse) {
+    auto rtt = ndn::time::duration_cast<ndn::time::nanoseconds>(
+                 ndn::time::steady_clock::now() - sentTime);
+    auto& counters = m_ribCommandCounters;
+    counters.lastRtt = rtt;
+    // Same smoothing factor (1/8) as the TCP retransmission timer (RFC 6298)
+    counters.srtt = counters.srtt == ndn::time::nanoseconds::zero() ?
+                    rtt : (counters.srtt * 7 + rtt) / 8;
+  }
+
+  dispatchRibCommands();
+}
+
 void
 Fib::setStrategy(const ndn::Name& name, const ndn::Name& strategy, uint32_t count)
 {
@@ -294,44 +480,104 @@ Fib::onSetStrategyFailure(const ndn::nfd::ControlResponse&,
 }
 
 void
-Fib::scheduleEntryRefresh(FibEntry& entry, uint64_t routeFlags, const AfterRefreshCallback& refreshCallback)
+Fib::scheduleEntryRefresh(FibEntry& entry, uint64_t routeFlags)
 {
+  double minFraction = entry.refreshTime ? REFRESH_MIN_FRACTION : FIRST_REFRESH_MIN_FRACTION;
+  std::uniform_real_distribution<double> dist(minFraction, 1.0);
+  double fraction = dist(ndn::random::getRandomNumberEngine());
+  auto delay = ndn::time::duration_cast<ndn::time::milliseconds>(
+                 ndn::time::duration<double>(m_refreshTime * fraction));
+
   NLSR_LOG_DEBUG("Scheduling refresh for " << entry.name <<
                  " Seq Num: " << entry.seqNo <<
-                 " in " << m_refreshTime << " seconds");
+                 " in " << delay);
+
+  entry.refreshTime = ndn::time::steady_clock::now() + delay;
+  entry.routeFlags = routeFlags;
+  bool isEarliest = m_refreshSchedule.empty() ||
+                    *entry.refreshTime < m_refreshSchedule.begin()->first;
+  m_refreshSchedule.emplace(*entry.refreshTime, entry.name);
 
-  entry.refreshEventId = m_scheduler.schedule(ndn::time::seconds(m_refreshTime),
-                                              std::bind(&Fib::refreshEntry, this,
-                                                        entry.name, routeFlags, refreshCallback));
+  if (isEarliest) {
+    scheduleRefreshTimer();
+  }
 }
 
 void
-Fib::scheduleLoop(FibEntry& entry, uint64_t routeFlags)
+Fib::scheduleRefreshTimer()
 {
-  scheduleEntryRefresh(entry, routeFlags, std::bind(&Fib::scheduleLoop, this, _1, _2));
+  if (m_refreshSchedule.empty()) {
+    m_refreshEvent.cancel();
+    return;
+  }
+
+  double rate = refillRefreshTokens();
+  auto now = ndn::time::steady_clock::now();
+  auto dueTime = m_refreshSchedule.begin()->first;
+
+  ndn::time::nanoseconds delay = ndn::time::nanoseconds::zero();
+  if (dueTime > now) {
+    delay = dueTime - now;
+  }
+  else if (m_refreshTokens < 1.0) {
+    // Wait until the bucket holds a token again
+    delay = ndn::time::duration_cast<ndn::time::nanoseconds>(
+              ndn::time::duration<double>((1.0 - m_refreshTokens) / rate));
+  }
+
+  m_refreshEvent = m_scheduler.schedule(delay, [this] { processRefreshes(); });
+}
+
+double
+Fib::refillRefreshTokens()
+{
+  double rate = std::max(1.0, REFRESH_RATE_FACTOR * m_table.size() / std::max(m_refreshTime, 1));
+  auto now = ndn::time::steady_clock::now();
+  ndn::time::duration<double> elapsed = now - m_lastRefreshRefill;
+  m_lastRefreshRefill = now;
+
+  // The bucket holds at most one second worth of refreshes
+  m_refreshTokens = std::min(rate, m_refreshTokens + rate * elapsed.count());
+  return rate;
 }
 
 void
-Fib::refreshEntry(const ndn::Name& name, uint64_t routeFlags, AfterRefreshCallback refreshCb)
+Fib::processRefreshes()
 {
-  auto it = m_table.find(name);
-  if (it == m_table.end()) {
-    return;
+  refillRefreshTokens();
+  auto now = ndn::time::steady_clock::now();
+
+  while (!m_refreshSchedule.empty() && m_refreshSchedule.begin()->first <= now &&
+         m_refreshTokens >= 1.0) {
+    auto scheduled = m_refreshSchedule.extract(m_refreshSchedule.begin());
+    auto it = m_table.find(scheduled.mapped());
+    // Skip entries that have been removed, or removed and installed again since
+    if (it == m_table.end() || it->second.refreshTime != scheduled.key()) {
+      continue;
+    }
+    m_refreshTokens -= 1.0;
+    refreshEntry(it->second);
   }
-  FibEntry& entry = it->second;
+
+  scheduleRefreshTimer();
+}
+
+void
+Fib::refreshEntry(FibEntry& entry)
+{
   NLSR_LOG_DEBUG("Refreshing " << entry.name << " Seq Num: " << entry.seqNo);
 
   entry.seqNo += 1;
 
   for (const NextHop& hop : entry.nexthopSet) {
-    registerPrefix(entry.name,
-                   ndn::FaceUri(hop.getConnectingFaceUri()),
-                   hop.getRouteCostAsAdjustedInteger(),
-                   ndn::time::seconds(m_refreshTime + GRACE_PERIOD),
-                   routeFlags, 0);
+    enqueueRegistration(entry.name,
+                        ndn::FaceUri(hop.getConnectingFaceUri()),
+                        hop.getRouteCostAsAdjustedInteger(),
+                        ndn::time::seconds(m_refreshTime + GRACE_PERIOD),
+                        entry.routeFlags, true);
   }
 
-  refreshCb(entry, routeFlags);
+  scheduleEntryRefresh(entry, entry.routeFlags);
 }
 
 void
@@ -343,6 +589,17 @@ Fib::writeLog()
     NLSR_LOG_DEBUG("Seq No: " <<  entry.second.seqNo);
     NLSR_LOG_DEBUG("Nexthop List: \n" << entry.second.nexthopSet);
   }
+
+  const auto& counters = m_ribCommandCounters;
+  NLSR_LOG_DEBUG("RIB commands queued: " << getRibCommandQueueSize() <<
+                 " (max " << counters.maxQueueSize << ")" <<
+                 " in flight: " << m_nInFlightCommands <<
+                 " sent: " << counters.nSent << " succeeded: " << counters.nSucceeded <<
+                 " failed: " << counters.nFailed << " retried: " << counters.nRetried <<
+                 " abandoned: " << counters.nAbandoned <<
+                 " suppressed: " << counters.nSuppressed <<
+                 " superseded: " << counters.nSuperseded <<
+                 " last RTT: " << counters.lastRtt << " SRTT: " << counters.srtt);
 }
 
 } // namespace nlsr
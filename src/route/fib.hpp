@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California,
  *                           Arizona Board of Regents.
  *
@@ -29,6 +29,11 @@
 #include <ndn-cxx/util/scheduler.hpp>
 #include <ndn-cxx/util/time.hpp>
 
+#include <deque>
+#include <map>
+#include <optional>
+#include <set>
+
 namespace nlsr {
 
 using NextHopsUriSortedSet = NexthopListT<NextHopUriSortedComparator>;
@@ -36,12 +41,37 @@ using NextHopsUriSortedSet = NexthopListT<NextHopUriSortedComparator>;
 struct FibEntry
 {
   ndn::Name name;
-  ndn::scheduler::ScopedEventId refreshEventId;
+  /// When the next hops are due to be registered again, unset if no refresh is scheduled.
+  std::optional<ndn::time::steady_clock::time_point> refreshTime;
+  uint64_t routeFlags = 0;
   int32_t seqNo = 1;
   NextHopsUriSortedSet nexthopSet;
+  /// Face URIs of next hops whose registration has been given up, until one succeeds.
+  std::set<ndn::FaceUri> abandonedFaceUris;
 };
 
-using AfterRefreshCallback = std::function<void(FibEntry&, uint64_t)>;
+/*! \brief Counters of the RIB commands issued by the FIB.
+ */
+struct RibCommandCounters
+{
+  uint64_t nSent = 0;
+  uint64_t nSucceeded = 0;
+  uint64_t nFailed = 0;
+  uint64_t nRetried = 0;
+  uint64_t nAbandoned = 0;
+  /// Registrations not sent because the next hop was already installed with the same cost
+  /// and flags.
+  uint64_t nSuppressed = 0;
+  /// Refreshes and retries dropped because a later command for the same prefix and face
+  /// had been queued.
+  uint64_t nSuperseded = 0;
+  /// Highest number of commands that have been waiting in the queue at once.
+  size_t maxQueueSize = 0;
+  /// Round-trip time of the last command that received a response.
+  ndn::time::nanoseconds lastRtt = ndn::time::nanoseconds::zero();
+  /// Smoothed round-trip time of the commands that received a response.
+  ndn::time::nanoseconds srtt = ndn::time::nanoseconds::zero();
+};
 
 class AdjacencyList;
 class ConfParameter;
@@ -55,6 +85,13 @@ class ConfParameter;
  * methods to inform NFD about these relationships. The FIB has its
  * entries populated by the NamePrefixTable
  *
+ * RIB commands are not sent to NFD right away. They are queued, and at most
+ * ConfParameter::getRibCommandWindow() of them are outstanding at any time. Registrations
+ * of new next hops and unregistrations are sent before the refreshes of existing next hops.
+ * Failed registrations are retried after an exponentially increasing delay. A registration or
+ * unregistration supersedes the refreshes and retries of earlier commands for the same prefix
+ * and face, so that those are never sent after it.
+ *
  * \sa nlsr::NamePrefixTable
  * \sa nlsr::NamePrefixTable::addEntry
  * \sa nlsr::NamePrefixTable::updateWithNewRoute
@@ -79,10 +116,10 @@ public:
   /*! \brief Set the nexthop list of a name.
    *
    * This method is the entry for others to add next-hop information
-   * to the FIB. Formally put, this method registers in NFD all
-   * next-hops in allHops, and unregisters the set difference of
-   * newHops - oldHops. This method also schedules the regular refresh
-   * of those next hops.
+   * to the FIB. Formally put, this method registers in NFD the
+   * next-hops in allHops that are not installed yet or whose cost has
+   * changed, and unregisters the set difference of oldHops - newHops.
+   * This method also schedules the regular refresh of those next hops.
    *
    * \param name The name prefix that the next-hops apply to
    * \param allHops A complete list of next-hops to associate with name.
@@ -113,25 +150,69 @@ public:
    * \param faceCost The cost to reach namePrefix through faceUri
    * \param timeout How long this registration should last
    * \param flags Route inheritance flags (CAPTURE, CHILD_INHERIT)
-   * \param times How many times we have failed to register this prefix since the last success.
-   *
-   * \sa Fib::registerPrefixInNfd
    */
   void
   registerPrefix(const ndn::Name& namePrefix,
                  const ndn::FaceUri& faceUri,
                  uint64_t faceCost,
                  const ndn::time::milliseconds& timeout,
-                 uint64_t flags,
-                 uint8_t times);
+                 uint64_t flags);
 
   void
   setStrategy(const ndn::Name& name, const ndn::Name& strategy, uint32_t count);
 
+  /*! \brief Return the number of RIB commands waiting to be sent.
+   */
+  size_t
+  getRibCommandQueueSize() const
+  {
+    return m_newCommands.size() + m_refreshCommands.size();
+  }
+
+  /*! \brief Return the number of RIB commands sent and not yet answered.
+   */
+  size_t
+  getNInFlightRibCommands() const
+  {
+    return m_nInFlightCommands;
+  }
+
+  const RibCommandCounters&
+  getRibCommandCounters() const
+  {
+    return m_ribCommandCounters;
+  }
+
   void
   writeLog();
 
 private:
+  struct RibCommand
+  {
+    bool isRegister;
+    bool isRefresh;
+    ndn::nfd::ControlParameters parameters;
+    ndn::FaceUri faceUri;
+    uint8_t nRetries = 0;
+    /// Assigned when the command is queued for the first time; kept by its retries.
+    uint64_t seqNo = 0;
+  };
+
+  using RibCommandKey = std::pair<ndn::Name, ndn::FaceUri>;
+
+  /*! \brief RIB commands for a prefix and face that are queued, in flight, or waiting to be
+   *         retried.
+   */
+  struct RibCommandKeyState
+  {
+    /// Sequence number of the latest command that is not a refresh.
+    uint64_t latestSeqNo = 0;
+    size_t nOutstanding = 0;
+    /// Sequence number of the command waiting to be retried, or 0 if there is none.
+    uint64_t retrySeqNo = 0;
+    ndn::scheduler::ScopedEventId retryEvent;
+  };
+
   /*! \brief Indicates whether a prefix is a direct neighbor or not.
    *
    * \return Whether the name is NOT associated with a direct neighbor
@@ -141,7 +222,9 @@ private:
 
   /*! \brief Does one half of the updating of a FibEntry with new next-hops.
    *
-   * Adds nexthops to a FibEntry and registers them in NFD.
+   * Adds nexthops to a FibEntry and registers them in NFD, unless the FibEntry
+   * already contains them with the same cost and flags, and their last registration
+   * has not been given up.
    * \sa Fib::update
    * \sa Fib::removeOldNextHopsFromFibEntryAndNfd
    */
@@ -151,25 +234,68 @@ private:
   unsigned int
   getNumberOfFacesForName(const NexthopList& nextHopList);
 
+  /*! \brief Queue the registration of a next hop in NFD's RIB.
+   *
+   * \param isRefresh Whether the next hop is already registered, in which case the
+   *                  registration is sent after all new registrations.
+   */
+  void
+  enqueueRegistration(const ndn::Name& namePrefix, const ndn::FaceUri& faceUri,
+                      uint64_t faceCost, const ndn::time::milliseconds& timeout,
+                      uint64_t flags, bool isRefresh);
+
   /*! \brief Unregisters a prefix from NFD's RIB.
    *
    */
   void
   unregisterPrefix(const ndn::Name& namePrefix, const ndn::FaceUri& faceUri);
 
+  /*! \brief Queue a new RIB command, superseding the earlier refreshes and retries for the same
+   *         prefix and face if it is not a refresh.
+   */
+  void
+  enqueueRibCommand(RibCommand command);
+
+  /*! \brief Put a command at the back of its queue and dispatch.
+   */
+  void
+  queueRibCommand(RibCommand command);
+
+  /*! \brief Whether a command that is not a refresh has been queued after @p command for the
+   *         same prefix and face.
+   */
+  bool
+  isSuperseded(const RibCommand& command) const;
+
+  /*! \brief Forget a command that has been answered, dropped, or abandoned.
+   */
+  void
+  releaseRibCommand(const RibCommand& command);
+
+  /*! \brief Send queued RIB commands while the in-flight window is not full.
+   */
+  void
+  dispatchRibCommands();
+
+  void
+  sendRibCommand(RibCommand command);
+
+  /*! \brief Account for a RIB command that has been answered or has timed out.
+   */
+  void
+  finishRibCommand(const ndn::time::steady_clock::time_point& sentTime, bool hasResponse);
+
   /*! \brief Log registration success, and update the Face ID associated with a URI.
    */
   void
   onRegistrationSuccess(const ndn::nfd::ControlParameters& param,
                         const ndn::FaceUri& faceUri);
 
-  /*! \brief Retry a prefix (next-hop) registration up to three (3) times.
+  /*! \brief Retry a prefix (next-hop) registration up to RIB_COMMAND_MAX_RETRIES times,
+   *         doubling the delay before each retry.
    */
   void
-  onRegistrationFailure(const ndn::nfd::ControlResponse& response,
-                        const ndn::nfd::ControlParameters& parameters,
-                        const ndn::FaceUri& faceUri,
-                        uint8_t times);
+  onRegistrationFailure(const ndn::nfd::ControlResponse& response, RibCommand command);
 
   /*! \brief Log a successful strategy setting.
    */
@@ -184,29 +310,38 @@ private:
                        uint32_t count);
 
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
-  /*! \brief Schedule a refresh event for an entry.
+  /*! \brief Schedule the next refresh of an entry.
    *
-   * Schedules a refresh event for an entry. In order to form a
-   * perpetual loop, refreshCallback needs to call
-   * Fib::scheduleEntryRefresh in some way, with refreshCallback being
-   * the same each time. In the current implementation, this is
-   * accomplished by having a separate function, Fib::scheduleLoop,
-   * that does this work.
-   * \sa Fib::scheduleLoop
+   * The first refresh of an entry happens at a random time in the second half of the
+   * refresh period, so that entries installed together, e.g., at startup, are not refreshed
+   * together. Each later refresh happens slightly less than one refresh period after the
+   * previous one, keeping the refreshes spread out.
    */
   void
-  scheduleEntryRefresh(FibEntry& entry, uint64_t routeFlags, const AfterRefreshCallback& refreshCb);
+  scheduleEntryRefresh(FibEntry& entry, uint64_t routeFlags);
 
 private:
-  /*! \brief Continue the entry refresh cycle.
+  /*! \brief (Re)arm the refresh timer for the next due entry.
    */
   void
-  scheduleLoop(FibEntry& entry, uint64_t routeFlags);
+  scheduleRefreshTimer();
+
+  /*! \brief Refresh the due entries, as many as the token bucket allows.
+   */
+  void
+  processRefreshes();
+
+  /*! \brief Add the tokens earned since the last refill to the refresh token bucket.
+   *
+   * \return The number of entries that may be refreshed per second.
+   */
+  double
+  refillRefreshTokens();
 
   /*! \brief Refreshes an entry in NFD.
    */
   void
-  refreshEntry(const ndn::Name& name, uint64_t routeFlags, AfterRefreshCallback refreshCb);
+  refreshEntry(FibEntry& entry);
 
 public:
   static inline const ndn::Name MULTICAST_STRATEGY{"/localhost/nfd/strategy/multicast"};
@@ -226,11 +361,36 @@ private:
   AdjacencyList& m_adjacencyList;
   ConfParameter& m_confParameter;
 
+  /// Entries to refresh, by the time they are due; removed entries are skipped when due.
+  std::multimap<ndn::time::steady_clock::time_point, ndn::Name> m_refreshSchedule;
+  ndn::scheduler::ScopedEventId m_refreshEvent;
+  double m_refreshTokens = 0.0;
+  ndn::time::steady_clock::time_point m_lastRefreshRefill;
+
+  std::deque<RibCommand> m_newCommands;
+  std::deque<RibCommand> m_refreshCommands;
+  std::map<RibCommandKey, RibCommandKeyState> m_ribCommandKeys;
+  uint64_t m_lastRibCommandSeqNo = 0;
+  size_t m_nInFlightCommands = 0;
+  RibCommandCounters m_ribCommandCounters;
+
   /*! GRACE_PERIOD A "window" we append to the timeout time to
    * allow for things like stuttering prefix registrations and
    * processing time when refreshing events.
    */
   static constexpr uint64_t GRACE_PERIOD = 10;
+
+  static constexpr uint8_t RIB_COMMAND_MAX_RETRIES = 3;
+  static constexpr ndn::time::milliseconds RIB_COMMAND_INITIAL_BACKOFF{1000};
+
+  /// Earliest first refresh of an entry, as a fraction of the refresh period.
+  static constexpr double FIRST_REFRESH_MIN_FRACTION = 0.5;
+  /// Earliest later refresh of an entry, as a fraction of the refresh period.
+  static constexpr double REFRESH_MIN_FRACTION = 0.9;
+  /*! The token bucket admits this many times the average refresh rate of the whole table,
+   * so that refreshes delayed by the bucket catch up well before their routes expire.
+   */
+  static constexpr double REFRESH_RATE_FACTOR = 4.0;
 };
 
 } // namespace nlsr
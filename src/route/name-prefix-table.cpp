@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California,
  *                           Arizona Board of Regents.
  *
@@ -77,9 +77,7 @@ NamePrefixTable::updateFromLsdb(std::shared_ptr<Lsa> lsa, LsdbUpdate updateType,
       auto nlsa = std::static_pointer_cast<NameLsa>(lsa);
       for (const auto &prefix : nlsa->getNpl().getPrefixInfo()) {
         if (prefix.getName() != m_ownRouterName) {
-          m_nexthopCost[DestNameKey(lsa->getOriginRouter(), prefix.getName())] = prefix.getCost();
-          // Don't use capture flag on advertised prefixes...
-          addEntry(prefix.getName(), lsa->getOriginRouter(), ndn::nfd::ROUTE_FLAG_CHILD_INHERIT);
+          addAdvertisedPrefix(lsa->getOriginRouter(), prefix, lsa->getShard());
         }
       }
     }
@@ -91,40 +89,77 @@ NamePrefixTable::updateFromLsdb(std::shared_ptr<Lsa> lsa, LsdbUpdate updateType,
 
     for (const auto &prefix : namesToAdd) {
       if (prefix.getName() != m_ownRouterName) {
-        m_nexthopCost[DestNameKey(lsa->getOriginRouter(), prefix.getName())] = prefix.getCost();
-        // Don't use capture flag on advertised prefixes...
-        addEntry(prefix.getName(), lsa->getOriginRouter(), ndn::nfd::ROUTE_FLAG_CHILD_INHERIT);
+        addAdvertisedPrefix(lsa->getOriginRouter(), prefix, lsa->getShard());
       }
     }
 
     for (const auto &prefix : namesToRemove) {
       if (prefix.getName() != m_ownRouterName) {
-        m_nexthopCost.erase(m_nexthopCost.find(DestNameKey(lsa->getOriginRouter(), prefix.getName())));
-        removeEntry(prefix.getName(), lsa->getOriginRouter());
+        removeAdvertisedPrefix(lsa->getOriginRouter(), prefix.getName(), lsa->getShard());
       }
     }
   }
   else {
-    removeEntry(lsa->getOriginRouter(), lsa->getOriginRouter());
+    // The other shards of a Name LSA only withdraw their own prefixes, not the router prefix
+    if (lsa->getShard() == 0) {
+      removeEntry(lsa->getOriginRouter(), lsa->getOriginRouter());
+    }
     if (lsa->getType() == Lsa::Type::NAME) {
       auto nlsa = std::static_pointer_cast<NameLsa>(lsa);
       for (const auto& name : nlsa->getNpl().getNames()) {
         if (name != m_ownRouterName) {
-          m_nexthopCost.erase(m_nexthopCost.find(DestNameKey(lsa->getOriginRouter(), name)));
-          removeEntry(name, lsa->getOriginRouter());
+          removeAdvertisedPrefix(lsa->getOriginRouter(), name, lsa->getShard());
         }
       }
     }
   }
 }
 
+void
+NamePrefixTable::addAdvertisedPrefix(const ndn::Name& destRouter, const PrefixInfo& prefix,
+                                     uint32_t shard)
+{
+  m_nexthopCost[DestNameKey(destRouter, prefix.getName())][shard] = prefix.getCost();
+  // Don't use capture flag on advertised prefixes...
+  addEntry(prefix.getName(), destRouter, ndn::nfd::ROUTE_FLAG_CHILD_INHERIT);
+}
+
+void
+NamePrefixTable::removeAdvertisedPrefix(const ndn::Name& destRouter, const ndn::Name& name,
+                                        uint32_t shard)
+{
+  auto costIt = m_nexthopCost.find(DestNameKey(destRouter, name));
+  if (costIt != m_nexthopCost.end()) {
+    costIt->second.erase(shard);
+    if (!costIt->second.empty()) {
+      // The prefix has moved to another shard, whose Name LSA was received first
+      NLSR_LOG_DEBUG(name << " is still advertised by another shard of " << destRouter);
+      auto nameItr = m_table.get<byName>().find(name);
+      if (nameItr != m_table.get<byName>().end()) {
+        updateFib(**nameItr, destRouter);
+      }
+      return;
+    }
+    m_nexthopCost.erase(costIt);
+  }
+  removeEntry(name, destRouter);
+}
+
 NexthopList
 NamePrefixTable::adjustNexthopCosts(const NexthopList& nhlist, const ndn::Name& nameToCheck, const ndn::Name& destRouterName)
 {
+  // While a prefix moves between shards, both may list it; the lower cost is used
+  double cost = 0;
+  auto costIt = m_nexthopCost.find(DestNameKey(destRouterName, nameToCheck));
+  if (costIt != m_nexthopCost.end() && !costIt->second.empty()) {
+    cost = std::min_element(costIt->second.begin(), costIt->second.end(),
+                            [] (const auto& a, const auto& b) { return a.second < b.second; })
+             ->second;
+  }
+
   NexthopList new_nhList;
   for (const auto& nh : nhlist.getNextHops()) {
-      const NextHop newNextHop = NextHop(nh.getConnectingFaceUri(), nh.getRouteCost() +
-                                              m_nexthopCost[DestNameKey(destRouterName, nameToCheck)]);
+      const NextHop newNextHop = NextHop(nh.getConnectingFaceUri(), nh.getRouteCost() + cost);
       new_nhList.addNextHop(newNextHop);
   }
   return new_nhList;
@@ -134,8 +169,7 @@ void
 NamePrefixTable::addEntry(const ndn::Name& name, const ndn::Name& destRouter, uint64_t routeFlags)
 {
   // Check if the advertised name prefix is in the table already.
-  auto nameItr = std::find_if(m_table.begin(), m_table.end(),
-                              [&] (const auto& entry) { return name == entry->getNamePrefix(); });
+  auto nameItr = m_table.project<0>(m_table.get<byName>().find(name));
 
   // Attempt to find a routing table pool entry (RTPE) we can use.
   auto rtpeItr = m_rtpool.find(destRouter);
@@ -236,8 +270,7 @@ NamePrefixTable::removeEntry(const ndn::Name& name, const ndn::Name& destRouter)
   std::shared_ptr<RoutingTablePoolEntry> rtpePtr = rtpeItr->second;
 
   // Ensure that the entry exists
-  auto nameItr = std::find_if(m_table.begin(), m_table.end(),
-                              [&] (const auto& entry) { return entry->getNamePrefix() == name; });
+  auto nameItr = m_table.project<0>(m_table.get<byName>().find(name));
   if (nameItr != m_table.end()) {
     std::shared_ptr<NamePrefixTableEntry> npte = *nameItr;
     NLSR_LOG_TRACE("Removing origin: " << rtpePtr->getDestination()
@@ -288,38 +321,66 @@ NamePrefixTable::updateWithNewRoute(const std::list<RoutingTableEntry>& entries)
 {
   NLSR_LOG_DEBUG("Updating table with newly calculated routes");
 
+  std::unordered_map<ndn::Name, const RoutingTableEntry*> entriesByDestination;
+  for (const auto& entry : entries) {
+    entriesByDestination.try_emplace(entry.getDestination(), &entry);
+  }
+
+  // Name prefixes whose next hops have changed, and the origin router they were changed for.
+  // A prefix advertised by several changed origins is updated in the FIB only once.
+  std::map<ndn::Name, ndn::Name> dirtyPrefixes;
+
   // Iterate over each pool entry we have
   for (auto&& poolEntryPair : m_rtpool) {
     auto&& poolEntry = poolEntryPair.second;
-    auto sourceEntry = std::find_if(entries.begin(), entries.end(),
-                                    [&poolEntry] (const RoutingTableEntry& entry) {
-                                      return poolEntry->getDestination() == entry.getDestination();
-                                    });
+    auto sourceEntry = entriesByDestination.find(poolEntry->getDestination());
     // If this pool entry has a corresponding entry in the routing table now
-    if (sourceEntry != entries.end()
-        && poolEntry->getNexthopList() != sourceEntry->getNexthopList()) {
+    if (sourceEntry != entriesByDestination.end()
+        && poolEntry->getNexthopList() != sourceEntry->second->getNexthopList()) {
       NLSR_LOG_DEBUG("Routing entry: " << poolEntry->getDestination() << " has changed next-hops.");
-      poolEntry->setNexthopList(sourceEntry->getNexthopList());
-      for (const auto& nameEntry : poolEntry->namePrefixTableEntries) {
-        auto nameEntryFullPtr = nameEntry.second.lock();
-        addEntry(nameEntryFullPtr->getNamePrefix(), poolEntry->getDestination(), nameEntryFullPtr->getFlags());
-      }
+      poolEntry->setNexthopList(sourceEntry->second->getNexthopList());
     }
-    else if (sourceEntry == entries.end()) {
+    else if (sourceEntry == entriesByDestination.end()
+             && poolEntry->getNexthopList().size() > 0) {
       NLSR_LOG_DEBUG("Routing entry: " << poolEntry->getDestination() << " now has no next-hops.");
       poolEntry->getNexthopList().clear();
-      for (const auto& nameEntry : poolEntry->namePrefixTableEntries) {
-        auto nameEntryFullPtr = nameEntry.second.lock();
-        addEntry(nameEntryFullPtr->getNamePrefix(), poolEntry->getDestination(), nameEntryFullPtr->getFlags());
-      }
     }
     else {
       NLSR_LOG_TRACE("No change in routing entry:" << poolEntry->getDestination()
                  << ", no action necessary.");
+      continue;
+    }
+
+    for (const auto& nameEntry : poolEntry->namePrefixTableEntries) {
+      dirtyPrefixes.insert_or_assign(nameEntry.first, poolEntry->getDestination());
+    }
+  }
+
+  NLSR_LOG_DEBUG("Updating FIB for " << dirtyPrefixes.size() << " name prefixes");
+  for (const auto& [name, destRouter] : dirtyPrefixes) {
+    auto nameItr = m_table.get<byName>().find(name);
+    if (nameItr != m_table.get<byName>().end()) {
+      updateFib(**nameItr, destRouter);
     }
   }
 }
 
+void
+NamePrefixTable::updateFib(NamePrefixTableEntry& npte, const ndn::Name& destRouter)
+{
+  npte.generateNhlfromRteList();
+  if (npte.getNexthopList().size() > 0) {
+    NLSR_LOG_TRACE("Updating FIB with next hops for " << npte);
+    m_fib.update(npte.getNamePrefix(),
+                 adjustNexthopCosts(npte.getNexthopList(), npte.getNamePrefix(), destRouter),
+                 npte.getFlags());
+  }
+  else {
+    NLSR_LOG_TRACE(npte.getNamePrefix() << " has no next hops; removing from FIB");
+    m_fib.remove(npte.getNamePrefix());
+  }
+}
+
 // Inserts the routing table pool entry into the NPT's RTE storage
 // pool.  This cannot fail, so the pool is guaranteed to contain the
 // item after this occurs.
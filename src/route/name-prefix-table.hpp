@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California,
  *                           Arizona Board of Regents.
  *
@@ -29,6 +29,11 @@
 #include "route/fib.hpp"
 #include "lsdb.hpp"
 
+#include <boost/multi_index_container.hpp>
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/mem_fun.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+
 #include <list>
 #include <unordered_map>
 
@@ -39,7 +44,25 @@ class NamePrefixTable
 public:
   using RoutingTableEntryPool =
     std::unordered_map<ndn::Name, std::shared_ptr<RoutingTablePoolEntry>>;
-  using NptEntryList = std::list<std::shared_ptr<NamePrefixTableEntry>>;
+  struct byName{};
+
+  /*! \brief Name prefix table entries in insertion order, indexed by name prefix.
+   *
+   *  The sequenced index keeps the order of dataset and log output stable, while the
+   *  hashed index locates an entry in constant time.
+   */
+  using NptEntryList = boost::multi_index_container<
+    std::shared_ptr<NamePrefixTableEntry>,
+    boost::multi_index::indexed_by<
+      boost::multi_index::sequenced<>,
+      boost::multi_index::hashed_unique<
+        boost::multi_index::tag<byName>,
+        boost::multi_index::const_mem_fun<NamePrefixTableEntry, const ndn::Name&,
+                                          &NamePrefixTableEntry::getNamePrefix>,
+        std::hash<ndn::Name>
+      >
+    >
+  >;
   using const_iterator = NptEntryList::const_iterator;
   using DestNameKey = std::tuple<ndn::Name, ndn::Name>;
 
@@ -101,6 +124,9 @@ public:
     the corresponding entry in entries. If no entry is found, it is
     assumed that the destination for that pool entry is inaccessible,
     and its next hop information is deleted.
+
+    Name prefixes affected by the changed pool entries are collected
+    first, and the FIB is updated once for each of them at the end.
    */
   void
   updateWithNewRoute(const std::list<RoutingTableEntry>& entries);
@@ -137,6 +163,26 @@ public:
   const_iterator
   end() const;
 
+private:
+  /*! \brief Records that a shard of the Name LSA of \p destRouter lists \p prefix, and adds
+   *         \p destRouter to its entry.
+   */
+  void
+  addAdvertisedPrefix(const ndn::Name& destRouter, const PrefixInfo& prefix, uint32_t shard);
+
+  /*! \brief Records that a shard of the Name LSA of \p destRouter no longer lists \p name,
+   *         and removes \p destRouter from its entry if no other shard lists it.
+   */
+  void
+  removeAdvertisedPrefix(const ndn::Name& destRouter, const ndn::Name& name, uint32_t shard);
+
+  /*! \brief Regenerates the next hops of an entry and installs them in the FIB.
+    \param npte The name prefix table entry
+    \param destRouter The origin router whose prefix cost is added to the next hops
+   */
+  void
+  updateFib(NamePrefixTableEntry& npte, const ndn::Name& destRouter);
+
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   RoutingTableEntryPool m_rtpool;
 
@@ -148,7 +194,11 @@ private:
   RoutingTable& m_routingTable;
   ndn::signal::Connection m_afterRoutingChangeConnection;
   ndn::signal::Connection m_afterLsdbModified;
-  std::map<std::tuple<ndn::Name, ndn::Name>, double> m_nexthopCost;
+  /**
+   * The cost of each prefix advertised by each router, by the Name LSA shard that lists it.
+   * A prefix moved to another shard is listed by both until the router's older LSA is replaced.
+   */
+  std::map<DestNameKey, std::map<uint32_t, double>> m_nexthopCost;
 };
 
 inline NamePrefixTable::const_iterator
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California,
  *                           Arizona Board of Regents.
  *
@@ -27,12 +27,21 @@
 #include "logger.hpp"
 #include "nlsr.hpp"
 
+#include <algorithm>
 #include <cmath>
 
 namespace nlsr {
 
 INIT_LOGGER(route.RoutingCalculatorHyperbolic);
 
+/**
+ * @brief Calculates hyperbolic paths from the coordinates of all routers.
+ *
+ * The coordinates are gathered once per calculation into one array per quantity, indexed by
+ * mapping number. Angular coordinates are converted to Euclidean coordinates on the unit sphere,
+ * so that the distances from a neighbor to all routers are computed by loops over contiguous
+ * arrays, without looking up LSAs or evaluating trigonometric functions for every pair.
+ */
 class HyperbolicRoutingCalculator
 {
 public:
@@ -44,41 +53,60 @@ public:
   }
 
   void
-  calculatePath(NameMap& map, RoutingTable& rt, Lsdb& lsdb, AdjacencyList& adjacencies);
+  calculatePath(NameMap& map, RoutingTableStatus& rt, const LsdbSnapshot& lsdb,
+                const AdjacencyList& adjacencies);
 
 private:
-  double
-  getHyperbolicDistance(Lsdb& lsdb, ndn::Name src, ndn::Name dest);
-
   void
-  addNextHop(const ndn::Name& destinationRouter, const ndn::FaceUri& faceUri, double cost, RoutingTable& rt);
-
-  double
-  calculateHyperbolicDistance(double rI, double rJ, double deltaTheta);
+  gatherCoordinates(const NameMap& map, const LsdbSnapshot& lsdb);
+
+  /**
+   * @brief Calculate the hyperbolic distances from @p src to all routers.
+   *
+   * The distance to a router is UNKNOWN_DISTANCE if either router has no valid coordinates,
+   * if their numbers of angles differ, or if they have the same angular coordinates.
+   */
+  void
+  calculateDistances(size_t src, std::vector<double>& distances) const;
 
-  double
-  calculateAngularDistance(std::vector<double> angleVectorI,
-                           std::vector<double> angleVectorJ);
+  void
+  addNextHop(const ndn::Name& destinationRouter, const ndn::FaceUri& faceUri, double cost,
+             RoutingTableStatus& rt);
 
 private:
   const size_t m_nRouters;
   const bool m_isDryRun;
   const ndn::Name m_thisRouterName;
+
+  /// Number of angles of each router, or 0 if the router has no valid coordinates.
+  std::vector<size_t> m_nAngles;
+  std::vector<double> m_coshRadius;
+  std::vector<double> m_sinhRadius;
+  /// Number of Euclidean coordinates stored for each router.
+  size_t m_nCoordinates = 0;
+  /**
+   * Euclidean coordinates on the unit sphere; coordinate k of router i is at k * m_nRouters + i.
+   * They are stored in the order x0, xn, x1, ..., x(n-1), padded with zeros.
+   */
+  std::vector<double> m_coordinates;
 };
 
 constexpr double UNKNOWN_DISTANCE = -1.0;
-constexpr double UNKNOWN_RADIUS   = -1.0;
 
 void
-HyperbolicRoutingCalculator::calculatePath(NameMap& map, RoutingTable& rt,
-                                           Lsdb& lsdb, AdjacencyList& adjacencies)
+HyperbolicRoutingCalculator::calculatePath(NameMap& map, RoutingTableStatus& rt,
+                                           const LsdbSnapshot& lsdb,
+                                           const AdjacencyList& adjacencies)
 {
   NLSR_LOG_TRACE("Calculating hyperbolic paths");
 
   auto thisRouter = map.getMappingNoByRouterName(m_thisRouterName);
 
+  gatherCoordinates(map, lsdb);
+  std::vector<double> distances;
+
   // Iterate over directly connected neighbors
-  std::list<Adjacent> neighbors = adjacencies.getAdjList();
+  const auto& neighbors = adjacencies.getAdjList();
   for (auto adj = neighbors.begin(); adj != neighbors.end(); ++adj) {
 
     // Don't calculate nexthops using an inactive router
@@ -104,13 +132,14 @@ HyperbolicRoutingCalculator::calculatePath(NameMap& map, RoutingTable& rt,
     }
 
     // Get hyperbolic distance from direct neighbor to every other router
+    calculateDistances(*src, distances);
     for (int dest = 0; dest < static_cast<int>(m_nRouters); ++dest) {
       // Don't calculate nexthops to this router or from a router to itself
       if (thisRouter && dest != *thisRouter && dest != *src) {
 
         auto destRouterName = map.getRouterNameByMappingNo(dest);
         if (destRouterName) {
-          double distance = getHyperbolicDistance(lsdb, srcRouterName, *destRouterName);
+          double distance = distances[dest];
 
           // Could not compute distance
           if (distance == UNKNOWN_DISTANCE) {
@@ -118,6 +147,8 @@ HyperbolicRoutingCalculator::calculatePath(NameMap& map, RoutingTable& rt,
                            << " to " << *destRouterName);
             continue;
           }
+          NLSR_LOG_TRACE("Distance from " << srcRouterName << " to " << *destRouterName
+                         << " is " << distance);
           addNextHop(*destRouterName, adj->getFaceUri(), distance, rt);
         }
       }
@@ -125,142 +156,119 @@ HyperbolicRoutingCalculator::calculatePath(NameMap& map, RoutingTable& rt,
   }
 }
 
-double
-HyperbolicRoutingCalculator::getHyperbolicDistance(Lsdb& lsdb, ndn::Name src, ndn::Name dest)
-{
-  NLSR_LOG_TRACE("Calculating hyperbolic distance from " << src << " to " << dest);
-
-  double distance = UNKNOWN_DISTANCE;
-
-  auto srcLsa  = lsdb.findLsa<CoordinateLsa>(src);
-  auto destLsa = lsdb.findLsa<CoordinateLsa>(dest);
-
-  // Coordinate LSAs do not exist for these routers
-  if (srcLsa == nullptr || destLsa == nullptr) {
-    return UNKNOWN_DISTANCE;
-  }
-
-  std::vector<double> srcTheta = srcLsa->getTheta();
-  std::vector<double> destTheta = destLsa->getTheta();
-
-  double srcRadius = srcLsa->getRadius();
-  double destRadius = destLsa->getRadius();
-
-  double diffTheta = calculateAngularDistance(srcTheta, destTheta);
-
-  if (srcRadius == UNKNOWN_RADIUS || destRadius == UNKNOWN_RADIUS ||
-      diffTheta == UNKNOWN_DISTANCE) {
-    return UNKNOWN_DISTANCE;
-  }
-
-  // double r_i, double r_j, double delta_theta, double zeta = 1 (default)
-  distance = calculateHyperbolicDistance(srcRadius, destRadius, diffTheta);
-
-  NLSR_LOG_TRACE("Distance from " << src << " to " << dest << " is " << distance);
-
-  return distance;
-}
-
-double
-HyperbolicRoutingCalculator::calculateAngularDistance(std::vector<double> angleVectorI,
-                                                      std::vector<double> angleVectorJ)
+void
+HyperbolicRoutingCalculator::gatherCoordinates(const NameMap& map, const LsdbSnapshot& lsdb)
 {
-  // It is not possible for angle vector size to be zero as ensured by conf-file-processor
-
   // https://en.wikipedia.org/wiki/N-sphere#Spherical_coordinates
+  std::vector<std::vector<double>> angles(m_nRouters);
+  m_nAngles.assign(m_nRouters, 0);
+  m_coshRadius.assign(m_nRouters, 0.0);
+  m_sinhRadius.assign(m_nRouters, 0.0);
+  size_t maxNAngles = 0;
+
+  for (size_t i = 0; i < m_nRouters; ++i) {
+    auto routerName = map.getRouterNameByMappingNo(static_cast<int32_t>(i));
+    if (!routerName) {
+      continue;
+    }
 
-  // Check if two vector lengths are the same
-  if (angleVectorI.size() != angleVectorJ.size()) {
-    NLSR_LOG_ERROR("Angle vector sizes do not match");
-    return UNKNOWN_DISTANCE;
-  }
+    auto lsa = lsdb.findLsa<CoordinateLsa>(*routerName);
+    // Coordinate LSA does not exist for this router
+    if (lsa == nullptr) {
+      continue;
+    }
 
-  // Check if all angles are within the [0, PI] and [0, 2PI] ranges
-  if (angleVectorI.size() > 1) {
-    for (unsigned int k = 0; k < angleVectorI.size() - 1; k++) {
-      if ((angleVectorI[k] > M_PI && angleVectorI[k] < 0.0) ||
-          (angleVectorJ[k] > M_PI && angleVectorJ[k] < 0.0)) {
-        NLSR_LOG_ERROR("Angle outside [0, PI]");
-        return UNKNOWN_DISTANCE;
-      }
+    // It is not possible for angle vector size to be zero as ensured by conf-file-processor
+    const auto& theta = lsa->getTheta();
+    if (theta.empty()) {
+      continue;
     }
-  }
 
-  if (angleVectorI[angleVectorI.size()-1] > 2.*M_PI ||
-      angleVectorI[angleVectorI.size()-1] < 0.0) {
-    NLSR_LOG_ERROR("Angle not within [0, 2PI]");
-    return UNKNOWN_DISTANCE;
-  }
+    if (theta.back() > 2. * M_PI || theta.back() < 0.0) {
+      NLSR_LOG_ERROR("Angle of " << *routerName << " not within [0, 2PI]");
+      continue;
+    }
 
-  if (angleVectorI[angleVectorI.size()-1] > 2.*M_PI ||
-      angleVectorI[angleVectorI.size()-1] < 0.0) {
-    NLSR_LOG_ERROR("Angle not within [0, 2PI]");
-    return UNKNOWN_DISTANCE;
-  }
+    double radius = lsa->getRadius();
+    if (radius <= 0.0) {
+      NLSR_LOG_ERROR("Radius of " << *routerName << " is <= 0");
+      continue;
+    }
 
-  // deltaTheta = arccos(vectorI . vectorJ) -> do the inner product
-  double innerProduct = 0.0;
+    m_nAngles[i] = theta.size();
+    m_coshRadius[i] = std::cosh(radius);
+    m_sinhRadius[i] = std::sinh(radius);
+    angles[i] = theta;
+    maxNAngles = std::max(maxNAngles, theta.size());
+  }
 
-  // Calculate x0 of the vectors
-  double x0i = std::cos(angleVectorI[0]);
-  double x0j = std::cos(angleVectorJ[0]);
+  m_nCoordinates = maxNAngles + 1;
+  m_coordinates.assign(m_nCoordinates * m_nRouters, 0.0);
 
-  // Calculate xn of the vectors
-  double xni = std::sin(angleVectorI[angleVectorI.size() - 1]);
-  double xnj = std::sin(angleVectorJ[angleVectorJ.size() - 1]);
+  for (size_t i = 0; i < m_nRouters; ++i) {
+    const auto& theta = angles[i];
+    if (theta.empty()) {
+      continue;
+    }
 
-  // Do the aggregation of the (n-1) coordinates (if there is more than one angle)
-  // i.e contraction of all (n-1)-dimensional angular coordinates to one variable
-  for (unsigned int k = 0; k < angleVectorI.size() - 1; k++) {
-    xni *= std::sin(angleVectorI[k]);
-    xnj *= std::sin(angleVectorJ[k]);
-  }
-  innerProduct += (x0i * x0j) + (xni * xnj);
-
-  // If d > 1
-  if (angleVectorI.size() > 1) {
-    for (unsigned int m = 1; m < angleVectorI.size(); m++) {
-      // calculate euclidean coordinates given the angles and assuming R_sphere = 1
-      double xmi = std::cos(angleVectorI[m]);
-      double xmj = std::cos(angleVectorJ[m]);
-      for (unsigned int l = 0; l < m; l++) {
-        xmi *= std::sin(angleVectorI[l]);
-        xmj *= std::sin(angleVectorJ[l]);
+    // Calculate x0 and xn, the latter being the contraction of all (n-1)-dimensional
+    // angular coordinates to one variable
+    double xn = std::sin(theta.back());
+    for (size_t k = 0; k < theta.size() - 1; ++k) {
+      xn *= std::sin(theta[k]);
+    }
+    m_coordinates[i] = std::cos(theta[0]);
+    m_coordinates[m_nRouters + i] = xn;
+
+    // Calculate x1, ..., x(n-1) if d > 1, assuming R_sphere = 1
+    for (size_t m = 1; m < theta.size(); ++m) {
+      double xm = std::cos(theta[m]);
+      for (size_t l = 0; l < m; ++l) {
+        xm *= std::sin(theta[l]);
       }
-      innerProduct += xmi * xmj;
+      m_coordinates[(m + 1) * m_nRouters + i] = xm;
     }
   }
-
-  // ArcCos of the inner product gives the angular distance
-  // between two points on a d-dimensional sphere
-  return std::acos(innerProduct);
 }
 
-double
-HyperbolicRoutingCalculator::calculateHyperbolicDistance(double rI, double rJ,
-                                                         double deltaTheta)
+void
+HyperbolicRoutingCalculator::calculateDistances(size_t src, std::vector<double>& distances) const
 {
-  if (deltaTheta == UNKNOWN_DISTANCE) {
-    return UNKNOWN_DISTANCE;
+  distances.assign(m_nRouters, 0.0);
+  if (m_nAngles[src] == 0) {
+    std::fill(distances.begin(), distances.end(), UNKNOWN_DISTANCE);
+    return;
   }
 
-  // Usually, we set zeta = 1 in all experiments
-  double zeta = 1;
-
-  if (deltaTheta <= 0.0 || rI <= 0.0 || rJ <= 0.0) {
-    NLSR_LOG_ERROR("Delta theta or rI or rJ is <= 0");
-    NLSR_LOG_ERROR("Please make sure that no two nodes have the exact same HR coordinates");
-    return UNKNOWN_DISTANCE;
+  // deltaTheta = arccos(vectorI . vectorJ); accumulate the inner products with all routers
+  // one coordinate at a time
+  double* innerProducts = distances.data();
+  for (size_t k = 0; k < m_nCoordinates; ++k) {
+    const double* coordinates = m_coordinates.data() + k * m_nRouters;
+    const double srcCoordinate = coordinates[src];
+    for (size_t i = 0; i < m_nRouters; ++i) {
+      innerProducts[i] += srcCoordinate * coordinates[i];
+    }
   }
 
-  double xij = (1. / zeta) * std::acosh(std::cosh(zeta*rI) * std::cosh(zeta*rJ) -
-               std::sinh(zeta*rI)*std::sinh(zeta*rJ)*std::cos(deltaTheta));
-  return xij;
+  // cos(deltaTheta) is the inner product itself, so the distance needs no trigonometry;
+  // usually, we set zeta = 1 in all experiments
+  const double coshSrc = m_coshRadius[src];
+  const double sinhSrc = m_sinhRadius[src];
+  const size_t nAngles = m_nAngles[src];
+  for (size_t i = 0; i < m_nRouters; ++i) {
+    const double cosDeltaTheta = innerProducts[i];
+    const double distance = std::acosh(coshSrc * m_coshRadius[i] -
+                                       sinhSrc * m_sinhRadius[i] * cosDeltaTheta);
+    // Delta theta is 0 when both routers have the same angular coordinates
+    const bool isKnown = m_nAngles[i] == nAngles && cosDeltaTheta < 1.0;
+    distances[i] = isKnown ? distance : UNKNOWN_DISTANCE;
+  }
 }
 
 void
 HyperbolicRoutingCalculator::addNextHop(const ndn::Name& dest, const ndn::FaceUri& faceUri,
-                                        double cost, RoutingTable& rt)
+                                        double cost, RoutingTableStatus& rt)
 {
   NextHop hop(faceUri, cost);
   hop.setHyperbolic(true);
@@ -276,8 +284,8 @@ HyperbolicRoutingCalculator::addNextHop(const ndn::Name& dest, const ndn::FaceUr
 }
 
 void
-calculateHyperbolicRoutingPath(NameMap& map, RoutingTable& rt, Lsdb& lsdb,
-                               AdjacencyList& adjacencies, ndn::Name thisRouterName,
+calculateHyperbolicRoutingPath(NameMap& map, RoutingTableStatus& rt, const LsdbSnapshot& lsdb,
+                               const AdjacencyList& adjacencies, ndn::Name thisRouterName,
                                bool isDryRun)
 {
   HyperbolicRoutingCalculator calculator(map.size(), isDryRun, thisRouterName);
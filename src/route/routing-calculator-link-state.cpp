@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California,
  *                           Arizona Board of Regents.
  *
@@ -22,12 +22,19 @@
 #include "routing-calculator.hpp"
 #include "name-map.hpp"
 #include "nexthop.hpp"
+#include "topology-graph.hpp"
 
 #include "adjacent.hpp"
 #include "logger.hpp"
 #include "nlsr.hpp"
 
-#include <boost/multi_array.hpp>
+#include <boost/asio/post.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <queue>
 
 namespace nlsr {
 namespace {
@@ -37,26 +44,22 @@ INIT_LOGGER(route.RoutingCalculatorLinkState);
 constexpr int EMPTY_PARENT = -12345;
 constexpr double INF_DISTANCE = 2147483647;
 constexpr int NO_NEXT_HOP = -12345;
+// Fraction of links that may change before a full calculation is preferred over repairing.
+constexpr double INCREMENTAL_SPF_MAX_CHANGED_LINKS = 0.1;
 
-/**
- * @brief Adjacency matrix.
- *
- * The matrix shall be a 2D array with N rows and N columns, where N is the number of routers.
- * Element i,j is the cost from router i to router j.
- */
-using AdjMatrix = boost::multi_array<double, 2>;
+using Link = TopologyGraph::Link;
 
-struct PrintAdjMatrix
+struct PrintTopology
 {
-  const AdjMatrix& matrix;
+  const TopologyGraph& graph;
   const NameMap& map;
 };
 
 /**
- * @brief Print adjacency matrix.
+ * @brief Print network topology.
  */
 std::ostream&
-operator<<(std::ostream& os, const PrintAdjMatrix& p)
+operator<<(std::ostream& os, const PrintTopology& p)
 {
   size_t nRouters = p.map.size();
 
@@ -65,109 +68,11 @@ operator<<(std::ostream& os, const PrintAdjMatrix& p)
     os << "Router:" << *p.map.getRouterNameByMappingNo(i)
        << " Index:" << i << "\n";
   }
-  os << " |";
-  for (size_t i = 0; i < nRouters; ++i) {
-    os << i << " ";
-  }
-  os << "\n";
-  os << "--";
-  for (size_t i = 0; i < nRouters; ++i) {
-    os << "--";
-  }
-  os << "\n";
-
-  for (size_t i = 0; i < nRouters; i++) {
-    os << i << "|";
-    for (size_t j = 0; j < nRouters; j++) {
-      double cost = p.matrix[i][j];
-      if (cost == NO_NEXT_HOP) {
-        os << "0 ";
-      }
-      else {
-        os << cost << " ";
-      }
-    }
-    os << "\n";
-  }
+  os << p.graph;
 
   return os;
 }
 
-/**
- * @brief Allocate and populate adjacency matrix.
- *
- * The adjacency matrix is resized to match the number of routers in @p map .
- * Costs from Adjacency LSAs are filled into the matrix; in case of a mismatch in bidirectional
- * costs, the higher cost is assigned for both directions.
- * All other elements are set to @c NON_ADJACENT_COST .
- */
-AdjMatrix
-makeAdjMatrix(const Lsdb& lsdb, NameMap& map)
-{
-  // Create the matrix to have N rows and N columns, where N is number of routers.
-  size_t nRouters = map.size();
-  AdjMatrix matrix(boost::extents[nRouters][nRouters]);
-
-  // Initialize all elements to NON_ADJACENT_COST.
-  std::fill_n(matrix.origin(), matrix.num_elements(), Adjacent::NON_ADJACENT_COST);
-
-  // For each LSA represented in the map
-  auto lsaRange = lsdb.getLsdbIterator<AdjLsa>();
-  for (auto lsaIt = lsaRange.first; lsaIt != lsaRange.second; ++lsaIt) {
-    auto adjLsa = std::static_pointer_cast<AdjLsa>(*lsaIt);
-    auto row = map.getMappingNoByRouterName(adjLsa->getOriginRouter());
-
-    std::list<Adjacent> adl = adjLsa->getAdl().getAdjList();
-    // For each adjacency represented in the LSA
-    for (const auto& adjacent : adl) {
-      auto col = map.getMappingNoByRouterName(adjacent.getName());
-      double cost = adjacent.getLinkCost();
-
-      if (row && col && *row < static_cast<int32_t>(nRouters)
-          && *col < static_cast<int32_t>(nRouters)) {
-        matrix[*row][*col] = cost;
-      }
-    }
-  }
-
-  // Links that do not have the same cost for both directions should
-  // have their costs corrected:
-  //
-  //   If the cost of one side of the link is NON_ADJACENT_COST (i.e. broken) or negative,
-  //   both direction of the link should have their cost corrected to NON_ADJACENT_COST.
-  //
-  //   Otherwise, both sides of the link should use the larger of the two costs.
-  //
-  // Additionally, this means that we can halve the amount of space
-  // that the matrix uses by only maintaining a triangle.
-  // - But that is not yet implemented.
-  for (size_t row = 0; row < nRouters; ++row) {
-    for (size_t col = 0; col < nRouters; ++col) {
-      double& toCost = matrix[row][col];
-      double& fromCost = matrix[col][row];
-
-      if (fromCost == toCost) {
-        continue;
-      }
-
-      // If both sides of the link are up, use the larger cost else break the link
-      double correctedCost = Adjacent::NON_ADJACENT_COST;
-      if (toCost >= 0 && fromCost >= 0) {
-        correctedCost = std::max(toCost, fromCost);
-      }
-
-      NLSR_LOG_WARN("Cost between [" << row << "][" << col << "] and [" << col << "][" << row <<
-                "] are not the same (" << toCost << " != " << fromCost << "). " <<
-                "Correcting to cost: " << correctedCost);
-
-      toCost = correctedCost;
-      fromCost = correctedCost;
-    }
-  }
-
-  return matrix;
-}
-
 void
 sortQueueByDistance(std::vector<int>& q, const std::vector<double>& dist, size_t start)
 {
@@ -191,80 +96,50 @@ isNotExplored(std::vector<int>& q, int u, size_t start)
   return false;
 }
 
-struct Link
-{
-  size_t index;
-  double cost;
-};
-
-/**
- * @brief List adjacencies and link costs from a source router.
- */
-std::vector<Link>
-gatherLinks(const AdjMatrix& matrix, int sourceRouter)
-{
-  size_t nRouters = matrix.size();
-  std::vector<Link> result;
-  result.reserve(nRouters);
-  for (size_t i = 0; i < nRouters; ++i) {
-    if (i == static_cast<size_t>(sourceRouter)) {
-      continue;
-    }
-    double cost = matrix[sourceRouter][i];
-    if (cost >= 0.0) {
-      result.emplace_back(Link{i, cost});
-    }
-  }
-  return result;
-}
-
 /**
- * @brief Adjust link costs to simulate having only one accessible neighbor.
+ * @brief Return links of a router to be considered in path calculation.
+ * @param onlyNeighbor If not null, the source router is considered to have this link only.
  */
-void
-simulateOneNeighbor(AdjMatrix& matrix, int sourceRouter, const Link& accessibleNeighbor)
+ndn::span<const Link>
+getLinksToExplore(const TopologyGraph& graph, int u, int sourceRouter, const Link* onlyNeighbor)
 {
-  size_t nRouters = matrix.size();
-  for (size_t i = 0; i < nRouters; ++i) {
-    if (i == accessibleNeighbor.index) {
-      matrix[sourceRouter][i] = accessibleNeighbor.cost;
-    }
-    else {
-      // if "i" is not a link to the source, set its cost to a non adjacent value.
-      matrix[sourceRouter][i] = Adjacent::NON_ADJACENT_COST;
-    }
+  if (u == sourceRouter && onlyNeighbor != nullptr) {
+    return ndn::span<const Link>(onlyNeighbor, 1);
   }
+  return graph.getLinks(u);
 }
 
-class DijkstraResult
+struct DijkstraResult
 {
-public:
-  int
-  getNextHop(int dest, int source) const
-  {
-    int nextHop = NO_NEXT_HOP;
-    while (parent[dest] != EMPTY_PARENT) {
-      nextHop = dest;
-      dest = parent[dest];
-    }
-    if (dest != source) {
-      nextHop = NO_NEXT_HOP;
-    }
-    return nextHop;
-  }
-
-public:
   std::vector<int> parent;
   std::vector<double> distance;
 };
 
+int
+getNextHop(const std::vector<int>& parent, int dest, int source)
+{
+  int nextHop = NO_NEXT_HOP;
+  while (parent[dest] != EMPTY_PARENT) {
+    nextHop = dest;
+    dest = parent[dest];
+  }
+  if (dest != source) {
+    nextHop = NO_NEXT_HOP;
+  }
+  return nextHop;
+}
+
 /**
  * @brief Compute the shortest path from a source router to every other router.
+ * @param onlyNeighbor If not null, the source router is considered to have this link only.
+ *
+ * This is the original algorithm that re-sorts the queue after exploring each router.
  */
 DijkstraResult
-calculateDijkstraPath(const AdjMatrix& matrix, int sourceRouter)
+calculateDijkstraPathLinear(const TopologyGraph& graph, int sourceRouter,
+                            const Link* onlyNeighbor = nullptr)
 {
-  size_t nRouters = matrix.size();
+  size_t nRouters = graph.size();
   std::vector<int> parent(nRouters, EMPTY_PARENT);
   // Array where the ith element is the distance to the router with mapping no i.
   std::vector<double> distance(nRouters, INF_DISTANCE);
@@ -285,13 +160,14 @@ calculateDijkstraPath(const AdjMatrix& matrix, int sourceRouter)
       break; // This can only happen when there are no accessible nodes.
     }
     // Iterate over the adjacent nodes to u.
-    for (size_t v = 0; v < nRouters; ++v) {
-      // If the current node is accessible and we haven't visited it yet.
-      if (matrix[u][v] >= 0 && isNotExplored(q, v, head + 1)) {
+    for (const auto& link : getLinksToExplore(graph, u, sourceRouter, onlyNeighbor)) {
+      int v = link.neighbor;
+      // If we haven't visited the adjacent node yet.
+      if (isNotExplored(q, v, head + 1)) {
         // And if the distance to this node + from this node to v
         // is less than the distance from our source node to v
         // that we got when we built the adj LSAs
-        double newDistance = distance[u] + matrix[u][v];
+        double newDistance = distance[u] + link.cost;
         if (newDistance < distance[v]) {
           // Set the new distance
           distance[v] = newDistance;
@@ -308,12 +184,259 @@ calculateDijkstraPath(const AdjMatrix& matrix, int sourceRouter)
   return DijkstraResult{std::move(parent), std::move(distance)};
 }
 
+/**
+ * @brief Compute the shortest path from a source router to every other router.
+ * @param onlyNeighbor If not null, the source router is considered to have this link only.
+ *
+ * This uses a binary heap with lazy deletion, so that the complexity is O((N + E) log N).
+ * When two routers have the same distance, the one with the lower mapping number is explored
+ * first, so that the result is deterministic.
+ */
+DijkstraResult
+calculateDijkstraPathHeap(const TopologyGraph& graph, int sourceRouter,
+                          const Link* onlyNeighbor = nullptr)
+{
+  size_t nRouters = graph.size();
+  std::vector<int> parent(nRouters, EMPTY_PARENT);
+  std::vector<double> distance(nRouters, INF_DISTANCE);
+  std::vector<bool> isExplored(nRouters, false);
+
+  using HeapEntry = std::pair<double, int>;
+  std::priority_queue<HeapEntry, std::vector<HeapEntry>, std::greater<HeapEntry>> heap;
+
+  distance[sourceRouter] = 0;
+  heap.emplace(0, sourceRouter);
+  while (!heap.empty()) {
+    double uDistance = heap.top().first;
+    int u = heap.top().second;
+    heap.pop();
+    // Skip stale entries of routers that have been reached via a shorter path.
+    if (isExplored[u]) {
+      continue;
+    }
+    isExplored[u] = true;
+
+    for (const auto& link : getLinksToExplore(graph, u, sourceRouter, onlyNeighbor)) {
+      int v = link.neighbor;
+      double newDistance = uDistance + link.cost;
+      if (!isExplored[v] && newDistance < distance[v]) {
+        distance[v] = newDistance;
+        parent[v] = u;
+        heap.emplace(newDistance, v);
+      }
+    }
+  }
+
+  return DijkstraResult{std::move(parent), std::move(distance)};
+}
+
+DijkstraResult
+calculateDijkstraPath(SpfAlgorithm algorithm, const TopologyGraph& graph, int sourceRouter,
+                      const Link* onlyNeighbor = nullptr)
+{
+  switch (algorithm) {
+    case SpfAlgorithm::LINEAR:
+      return calculateDijkstraPathLinear(graph, sourceRouter, onlyNeighbor);
+    case SpfAlgorithm::HEAP:
+    default:
+      return calculateDijkstraPathHeap(graph, sourceRouter, onlyNeighbor);
+  }
+}
+
+/**
+ * @brief Invoke a function for each index in [0, n), on @p threadPool if there is one.
+ */
+void
+forEachIndexInParallel(SpfThreadPool* threadPool, size_t n, const std::function<void(size_t)>& f)
+{
+  if (threadPool == nullptr) {
+    for (size_t i = 0; i < n; ++i) {
+      f(i);
+    }
+    return;
+  }
+  threadPool->forEachIndex(n, f);
+}
+
+/**
+ * @brief A change in the cost of a directed link.
+ *
+ * A cost of @c Adjacent::NON_ADJACENT_COST means the link does not exist.
+ */
+struct LinkChange
+{
+  int32_t from;
+  int32_t to;
+  double oldCost;
+  double newCost;
+};
+
+bool
+isCostIncrease(const LinkChange& change)
+{
+  return change.newCost < 0 || (change.oldCost >= 0 && change.newCost > change.oldCost);
+}
+
+/**
+ * @brief Append the links of a router that differ between two topologies.
+ */
+void
+findChangedLinks(const TopologyGraph& oldGraph, const TopologyGraph& newGraph, int32_t router,
+                 std::vector<LinkChange>& changes)
+{
+  ndn::span<const Link> oldLinks;
+  if (static_cast<size_t>(router) < oldGraph.size()) {
+    oldLinks = oldGraph.getLinks(router);
+  }
+  auto newLinks = newGraph.getLinks(router);
+
+  // Both link lists are sorted by neighbor mapping number.
+  auto oldIt = oldLinks.begin();
+  auto newIt = newLinks.begin();
+  while (oldIt != oldLinks.end() || newIt != newLinks.end()) {
+    if (newIt == newLinks.end() ||
+        (oldIt != oldLinks.end() && oldIt->neighbor < newIt->neighbor)) {
+      changes.push_back({router, oldIt->neighbor, oldIt->cost, Adjacent::NON_ADJACENT_COST});
+      ++oldIt;
+    }
+    else if (oldIt == oldLinks.end() || newIt->neighbor < oldIt->neighbor) {
+      changes.push_back({router, newIt->neighbor, Adjacent::NON_ADJACENT_COST, newIt->cost});
+      ++newIt;
+    }
+    else {
+      if (oldIt->cost != newIt->cost) {
+        changes.push_back({router, newIt->neighbor, oldIt->cost, newIt->cost});
+      }
+      ++oldIt;
+      ++newIt;
+    }
+  }
+}
+
+/**
+ * @brief Repair a shortest path tree after some links have changed.
+ * @param graph Topology after the changes; it may contain more routers than the tree.
+ * @param onlyNeighbor If not null, the source router is considered to have this link only.
+ * @param changes Changed links, in both directions.
+ * @param[in,out] parent Parents of routers in the tree.
+ * @param[in,out] distance Distances of routers in the tree.
+ *
+ * Routers whose shortest path goes through a link that became more expensive or disappeared are
+ * detached from the tree and reattached via their best unaffected neighbor. Links that became
+ * cheaper or appeared lower the distances of their far ends. From there, Dijkstra's algorithm
+ * runs over the routers whose distance has changed only.
+ */
+void
+repairDijkstraPath(const TopologyGraph& graph, int sourceRouter, const Link* onlyNeighbor,
+                   const std::vector<LinkChange>& changes,
+                   std::vector<int>& parent, std::vector<double>& distance)
+{
+  size_t nRouters = graph.size();
+  parent.resize(nRouters, EMPTY_PARENT);
+  distance.resize(nRouters, INF_DISTANCE);
+
+  auto isUsable = [=] (int from, int to) {
+    return from != sourceRouter || onlyNeighbor == nullptr || to == onlyNeighbor->neighbor;
+  };
+
+  // Mark the subtrees below tree links that became more expensive or disappeared.
+  enum : uint8_t { UNKNOWN, AFFECTED, UNAFFECTED };
+  std::vector<uint8_t> state(nRouters, UNKNOWN);
+  bool hasAffected = false;
+  for (const auto& change : changes) {
+    if (isCostIncrease(change) && parent[change.to] == change.from) {
+      state[change.to] = AFFECTED;
+      hasAffected = true;
+    }
+  }
+
+  std::vector<int> affected;
+  if (hasAffected) {
+    // Walk up the tree from each router until reaching a router whose state is known.
+    std::vector<int> path;
+    for (size_t i = 0; i < nRouters; ++i) {
+      int u = static_cast<int>(i);
+      while (state[u] == UNKNOWN && parent[u] != EMPTY_PARENT) {
+        path.push_back(u);
+        u = parent[u];
+      }
+      if (state[u] == UNKNOWN) {
+        state[u] = UNAFFECTED;
+      }
+      for (int v : path) {
+        state[v] = state[u];
+      }
+      path.clear();
+    }
+
+    for (size_t i = 0; i < nRouters; ++i) {
+      if (state[i] == AFFECTED) {
+        affected.push_back(static_cast<int>(i));
+        parent[i] = EMPTY_PARENT;
+        distance[i] = INF_DISTANCE;
+      }
+    }
+  }
+
+  using HeapEntry = std::pair<double, int>;
+  std::priority_queue<HeapEntry, std::vector<HeapEntry>, std::greater<HeapEntry>> heap;
+
+  for (int v : affected) {
+    // Links are symmetric, so each link of v is also a link from the neighbor to v.
+    for (const auto& link : graph.getLinks(v)) {
+      int u = link.neighbor;
+      if (state[u] != AFFECTED && distance[u] != INF_DISTANCE && isUsable(u, v) &&
+          distance[u] + link.cost < distance[v]) {
+        distance[v] = distance[u] + link.cost;
+        parent[v] = u;
+      }
+    }
+    if (distance[v] != INF_DISTANCE) {
+      heap.emplace(distance[v], v);
+    }
+  }
+
+  for (const auto& change : changes) {
+    if (isCostIncrease(change) || !isUsable(change.from, change.to) ||
+        distance[change.from] == INF_DISTANCE) {
+      continue;
+    }
+    double newDistance = distance[change.from] + change.newCost;
+    if (newDistance < distance[change.to]) {
+      distance[change.to] = newDistance;
+      parent[change.to] = change.from;
+      heap.emplace(newDistance, change.to);
+    }
+  }
+
+  while (!heap.empty()) {
+    double uDistance = heap.top().first;
+    int u = heap.top().second;
+    heap.pop();
+    // Skip stale entries of routers that have been reached via a shorter path.
+    if (uDistance > distance[u]) {
+      continue;
+    }
+
+    for (const auto& link : getLinksToExplore(graph, u, sourceRouter, onlyNeighbor)) {
+      int v = link.neighbor;
+      double newDistance = uDistance + link.cost;
+      if (newDistance < distance[v]) {
+        distance[v] = newDistance;
+        parent[v] = u;
+        heap.emplace(newDistance, v);
+      }
+    }
+  }
+}
+
 /**
  * @brief Insert shortest paths into the routing table.
  */
 void
-addNextHopsToRoutingTable(RoutingTable& rt, const NameMap& map, int sourceRouter,
-                          const AdjacencyList& adjacencies, const DijkstraResult& dr)
+addNextHopsToRoutingTable(RoutingTableStatus& rt, const NameMap& map, int sourceRouter,
+                          const AdjacencyList& adjacencies, const std::vector<int>& parent,
+                          const std::vector<double>& distance)
 {
   NLSR_LOG_DEBUG("addNextHopsToRoutingTable Called");
   int nRouters = static_cast<int>(map.size());
@@ -325,14 +448,14 @@ addNextHopsToRoutingTable(RoutingTable& rt, const NameMap& map, int sourceRouter
     }
 
     // Obtain the next hop that was determined by the algorithm
-    int nextHopRouter = dr.getNextHop(i, sourceRouter);
+    int nextHopRouter = getNextHop(parent, i, sourceRouter);
     if (nextHopRouter == NO_NEXT_HOP) {
       continue;
     }
     // If this router is accessible at all
 
     // Fetch its distance
-    double routeCost = dr.distance[i];
+    double routeCost = distance[i];
     // Fetch its actual name
     auto nextHopRouterName = map.getRouterNameByMappingNo(nextHopRouter);
     BOOST_ASSERT(nextHopRouterName.has_value());
@@ -345,9 +468,71 @@ addNextHopsToRoutingTable(RoutingTable& rt, const NameMap& map, int sourceRouter
 
 } // anonymous namespace
 
+SpfThreadPool::SpfThreadPool(uint32_t nThreads)
+  : m_nThreads(std::max<uint32_t>(nThreads, 1))
+{
+  if (m_nThreads > 1) {
+    m_pool = std::make_unique<boost::asio::thread_pool>(m_nThreads - 1);
+  }
+}
+
+void
+SpfThreadPool::forEachIndex(size_t n, const std::function<void(size_t)>& f)
+{
+  size_t nWorkers = m_pool == nullptr || n <= 1 ? 0 : std::min<size_t>(m_nThreads, n) - 1;
+  if (nWorkers == 0) {
+    for (size_t i = 0; i < n; ++i) {
+      f(i);
+    }
+    return;
+  }
+
+  std::atomic<size_t> nextIndex{0};
+  std::mutex mutex;
+  std::condition_variable cv;
+  size_t nFinished = 0;
+  std::exception_ptr error;
+
+  // An exception stops handing out indices, and is rethrown once all threads have stopped
+  auto work = [&] {
+    try {
+      for (size_t i = nextIndex++; i < n; i = nextIndex++) {
+        f(i);
+      }
+    }
+    catch (...) {
+      nextIndex = n;
+      std::lock_guard<std::mutex> lock(mutex);
+      if (error == nullptr) {
+        error = std::current_exception();
+      }
+    }
+  };
+
+  for (size_t worker = 0; worker < nWorkers; ++worker) {
+    boost::asio::post(*m_pool, [&] {
+      work();
+      std::lock_guard<std::mutex> lock(mutex);
+      if (++nFinished == nWorkers) {
+        cv.notify_one();
+      }
+    });
+  }
+
+  // The invoking thread takes part as well, and then waits for the workers, which refer to
+  // the locals of this function
+  work();
+  std::unique_lock<std::mutex> lock(mutex);
+  cv.wait(lock, [&] { return nFinished == nWorkers; });
+  if (error != nullptr) {
+    std::rethrow_exception(error);
+  }
+}
+
 void
-calculateLinkStateRoutingPath(NameMap& map, RoutingTable& rt, ConfParameter& confParam,
-                              const Lsdb& lsdb)
+calculateLinkStateRoutingPath(NameMap& map, RoutingTableStatus& rt, const ConfParameter& confParam,
+                              const AdjacencyList& adjacencies, const LsdbSnapshot& lsdb,
+                              SpfThreadPool* threadPool)
 {
   NLSR_LOG_DEBUG("calculateLinkStateRoutingPath called");
 
@@ -357,29 +542,206 @@ calculateLinkStateRoutingPath(NameMap& map, RoutingTable& rt, ConfParameter& con
     return;
   }
 
-  AdjMatrix matrix = makeAdjMatrix(lsdb, map);
-  NLSR_LOG_DEBUG((PrintAdjMatrix{matrix, map}));
+  auto lsaRange = lsdb.getLsdbIterator<AdjLsa>();
+  auto graph = TopologyGraph::createFromAdjLsdb(lsaRange.first, lsaRange.second, map);
+  NLSR_LOG_DEBUG((PrintTopology{graph, map}));
 
+  SpfAlgorithm algorithm = confParam.getSpfAlgorithm();
   if (confParam.getMaxFacesPerPrefix() == 1) {
     // In the single path case we can simply run Dijkstra's algorithm.
-    auto dr = calculateDijkstraPath(matrix, *sourceRouter);
+    auto dr = calculateDijkstraPath(algorithm, graph, *sourceRouter);
     // Inform the routing table of the new next hops.
-    addNextHopsToRoutingTable(rt, map, *sourceRouter, confParam.getAdjacencyList(), dr);
+    addNextHopsToRoutingTable(rt, map, *sourceRouter, adjacencies,
+                              dr.parent, dr.distance);
   }
   else {
     // Multi Path
-    // Gets a sparse listing of adjacencies for path calculation
-    auto links = gatherLinks(matrix, *sourceRouter);
-    for (const auto& link : links) {
-      // Simulate that only the current neighbor is accessible
-      simulateOneNeighbor(matrix, *sourceRouter, link);
-      NLSR_LOG_DEBUG((PrintAdjMatrix{matrix, map}));
-      // Do Dijkstra's algorithm using the current neighbor as your start.
-      auto dr = calculateDijkstraPath(matrix, *sourceRouter);
-      // Update the routing table with the calculations.
-      addNextHopsToRoutingTable(rt, map, *sourceRouter, confParam.getAdjacencyList(), dr);
+    auto links = graph.getLinks(*sourceRouter);
+    std::vector<DijkstraResult> results(links.size());
+    // The graph is not modified, so the calculations via different neighbors are independent.
+    forEachIndexInParallel(threadPool, links.size(), [&] (size_t i) {
+      // Do Dijkstra's algorithm, simulating that only the current neighbor is accessible.
+      results[i] = calculateDijkstraPath(algorithm, graph, *sourceRouter, &links[i]);
+    });
+    // Update the routing table with the calculations, in the same order as links.
+    for (const auto& dr : results) {
+      addNextHopsToRoutingTable(rt, map, *sourceRouter, adjacencies,
+                                dr.parent, dr.distance);
     }
   }
 }
 
+void
+IncrementalLinkStateCalculator::calculatePath(RoutingTableStatus& rt,
+                                              const ConfParameter& confParam,
+                                              const AdjacencyList& adjacencies,
+                                              const LsdbSnapshot& lsdb,
+                                              const std::set<ndn::Name>& changedRouters,
+                                              SpfThreadPool* threadPool)
+{
+  NLSR_LOG_DEBUG("IncrementalLinkStateCalculator::calculatePath called");
+
+  bool isMultiPath = confParam.getMaxFacesPerPrefix() != 1;
+  if (m_graph && m_isMultiPath == isMultiPath &&
+      repair(confParam, lsdb, changedRouters, threadPool)) {
+    ++m_nIncrementalCalculations;
+  }
+  else {
+    calculateFull(confParam, lsdb, isMultiPath, threadPool);
+    ++m_nFullCalculations;
+  }
+
+  for (const auto& tree : m_trees) {
+    addNextHopsToRoutingTable(rt, m_map, m_sourceRouter, adjacencies, tree.parent, tree.distance);
+  }
+}
+
+void
+IncrementalLinkStateCalculator::reset()
+{
+  m_map = NameMap();
+  m_graph.reset();
+  m_trees.clear();
+  m_sourceRouter = -1;
+}
+
+void
+IncrementalLinkStateCalculator::calculateFull(const ConfParameter& confParam,
+                                              const LsdbSnapshot& lsdb, bool isMultiPath,
+                                              SpfThreadPool* threadPool)
+{
+  reset();
+  m_isMultiPath = isMultiPath;
+
+  auto lsaRange = lsdb.getLsdbIterator<AdjLsa>();
+  m_map = NameMap::createFromAdjLsdb(lsaRange.first, lsaRange.second);
+  auto sourceRouter = m_map.getMappingNoByRouterName(confParam.getRouterPrefix());
+  if (!sourceRouter) {
+    NLSR_LOG_DEBUG("Source router is absent, nothing to do");
+    return;
+  }
+  m_sourceRouter = *sourceRouter;
+
+  m_graph = TopologyGraph::createFromAdjLsdb(lsaRange.first, lsaRange.second, m_map);
+  NLSR_LOG_DEBUG((PrintTopology{*m_graph, m_map}));
+
+  SpfAlgorithm algorithm = confParam.getSpfAlgorithm();
+  if (!isMultiPath) {
+    auto dr = calculateDijkstraPath(algorithm, *m_graph, m_sourceRouter);
+    m_trees.push_back({-1, std::move(dr.parent), std::move(dr.distance)});
+  }
+  else {
+    auto links = m_graph->getLinks(m_sourceRouter);
+    m_trees.resize(links.size());
+    forEachIndexInParallel(threadPool, links.size(), [&] (size_t i) {
+      auto dr = calculateDijkstraPath(algorithm, *m_graph, m_sourceRouter, &links[i]);
+      m_trees[i] = {links[i].neighbor, std::move(dr.parent), std::move(dr.distance)};
+    });
+  }
+}
+
+bool
+IncrementalLinkStateCalculator::repair(const ConfParameter& confParam, const LsdbSnapshot& lsdb,
+                                       const std::set<ndn::Name>& changedRouters,
+                                       SpfThreadPool* threadPool)
+{
+  // New routers are appended, so that the trees remain valid for known routers.
+  auto lsaRange = lsdb.getLsdbIterator<AdjLsa>();
+  for (auto it = lsaRange.first; it != lsaRange.second; ++it) {
+    auto lsa = static_cast<const AdjLsa*>(it->get());
+    m_map.addEntry(lsa->getOriginRouter());
+    for (const auto& adjacent : lsa->getAdl()) {
+      m_map.addEntry(adjacent.getName());
+    }
+  }
+
+  auto sourceRouter = m_map.getMappingNoByRouterName(confParam.getRouterPrefix());
+  if (!sourceRouter || *sourceRouter != m_sourceRouter) {
+    return false;
+  }
+
+  auto graph = TopologyGraph::createFromAdjLsdb(lsaRange.first, lsaRange.second, m_map);
+
+  // Removed routers stay in the map without links until the next full calculation.
+  size_t nIsolatedRouters = 0;
+  for (size_t i = 0; i < graph.size(); ++i) {
+    nIsolatedRouters += graph.getLinks(static_cast<int32_t>(i)).empty();
+  }
+  if (nIsolatedRouters * 2 > graph.size()) {
+    NLSR_LOG_DEBUG("Too many removed routers, performing full calculation");
+    return false;
+  }
+
+  // A link only changes when the Adjacency LSA of either end changes.
+  std::vector<bool> isChanged(graph.size(), false);
+  for (const auto& routerName : changedRouters) {
+    auto router = m_map.getMappingNoByRouterName(routerName);
+    if (router) {
+      isChanged[*router] = true;
+    }
+  }
+  std::vector<LinkChange> changes;
+  for (size_t i = 0; i < graph.size(); ++i) {
+    if (isChanged[i]) {
+      findChangedLinks(*m_graph, graph, static_cast<int32_t>(i), changes);
+    }
+  }
+  for (size_t i = 0, nChanges = changes.size(); i < nChanges; ++i) {
+    LinkChange change = changes[i];
+    if (!isChanged[change.to]) {
+      changes.push_back({change.to, change.from, change.oldCost, change.newCost});
+    }
+  }
+
+  size_t nLinks = std::max(graph.getNLinks(), m_graph->getNLinks());
+  if (changes.size() > 2 * INCREMENTAL_SPF_MAX_CHANGED_LINKS * nLinks) {
+    NLSR_LOG_DEBUG(changes.size() / 2 << " of " << nLinks
+                   << " links have changed, performing full calculation");
+    return false;
+  }
+
+  NLSR_LOG_DEBUG("Repairing shortest path trees for " << changes.size() / 2 << " changed links");
+  NLSR_LOG_DEBUG((PrintTopology{graph, m_map}));
+
+  if (!m_isMultiPath) {
+    auto& tree = m_trees.front();
+    repairDijkstraPath(graph, m_sourceRouter, nullptr, changes, tree.parent, tree.distance);
+  }
+  else {
+    // There is one tree per link of the source router. Trees of removed links are discarded,
+    // and trees of new links (which have no parent array yet) are calculated from scratch.
+    auto links = graph.getLinks(m_sourceRouter);
+    std::vector<ShortestPathTree> trees(links.size());
+    auto treeIt = m_trees.begin();
+    for (size_t i = 0; i < links.size(); ++i) {
+      while (treeIt != m_trees.end() && treeIt->neighbor < links[i].neighbor) {
+        ++treeIt;
+      }
+      if (treeIt != m_trees.end() && treeIt->neighbor == links[i].neighbor) {
+        trees[i] = std::move(*treeIt);
+      }
+      else {
+        trees[i].neighbor = links[i].neighbor;
+      }
+    }
+
+    forEachIndexInParallel(threadPool, links.size(), [&] (size_t i) {
+      auto& tree = trees[i];
+      if (tree.parent.empty()) {
+        auto dr = calculateDijkstraPath(confParam.getSpfAlgorithm(), graph, m_sourceRouter,
+                                        &links[i]);
+        tree.parent = std::move(dr.parent);
+        tree.distance = std::move(dr.distance);
+      }
+      else {
+        repairDijkstraPath(graph, m_sourceRouter, &links[i], changes, tree.parent, tree.distance);
+      }
+    });
+    m_trees = std::move(trees);
+  }
+
+  m_graph = std::move(graph);
+  return true;
+}
+
 } // namespace nlsr
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California
  *
  * This file is part of NLSR (Named-data Link State Routing).
@@ -23,19 +23,134 @@
 
 #include "common.hpp"
 #include "lsdb.hpp"
+#include "name-map.hpp"
+#include "topology-graph.hpp"
+
+#include <boost/asio/thread_pool.hpp>
+#include <boost/noncopyable.hpp>
+
+#include <optional>
+#include <set>
 
 namespace nlsr {
 
-class NameMap;
-class RoutingTable;
+class RoutingTableStatus;
+
+/**
+ * @brief Worker threads for the shortest path calculations via different neighbors.
+ *
+ * The threads are started once and reused by every routing calculation.
+ */
+class SpfThreadPool : boost::noncopyable
+{
+public:
+  /**
+   * @param nThreads Number of threads taking part in a calculation, including the thread that
+   *                 invokes forEachIndex.
+   */
+  explicit
+  SpfThreadPool(uint32_t nThreads);
+
+  /**
+   * @brief Invoke @p f for each index in [0, n), and wait until all invocations have returned.
+   *
+   * @p f must be safe to invoke concurrently for different indices. If it throws, no further
+   * index is handed out, and the first exception is rethrown once all threads have stopped.
+   */
+  void
+  forEachIndex(size_t n, const std::function<void(size_t)>& f);
+
+private:
+  const uint32_t m_nThreads;
+  std::unique_ptr<boost::asio::thread_pool> m_pool;
+};
 
+/**
+ * @param threadPool Threads for the calculations via different neighbors, or nullptr to
+ *                   calculate on the invoking thread only.
+ */
 void
-calculateLinkStateRoutingPath(NameMap& map, RoutingTable& rt, ConfParameter& confParam,
-                              const Lsdb& lsdb);
+calculateLinkStateRoutingPath(NameMap& map, RoutingTableStatus& rt, const ConfParameter& confParam,
+                              const AdjacencyList& adjacencies, const LsdbSnapshot& lsdb,
+                              SpfThreadPool* threadPool = nullptr);
+
+/**
+ * @brief Link-state routing calculator that repairs shortest path trees incrementally.
+ *
+ * The calculator keeps the topology and the shortest path trees of the previous calculation.
+ * When Adjacency LSAs change, only the links of their origin routers are compared against the
+ * previous topology, and only the routers whose shortest paths go through a link that became
+ * more expensive or disappeared are recomputed. Distances are the same as a full calculation,
+ * but among several equal-cost paths a different one may be chosen.
+ *
+ * A full calculation is performed for the first time, when the router itself or the
+ * multi-path setting changes, and when too many links have changed at once.
+ */
+class IncrementalLinkStateCalculator
+{
+public:
+  /**
+   * @brief Calculate shortest paths and insert them into the routing table.
+   * @param changedRouters Routers whose Adjacency LSA has been installed, updated, or removed
+   *                       since the previous calculation.
+   * @param threadPool Threads for the calculations via different neighbors, or nullptr to
+   *                   calculate on the invoking thread only.
+   */
+  void
+  calculatePath(RoutingTableStatus& rt, const ConfParameter& confParam,
+                const AdjacencyList& adjacencies, const LsdbSnapshot& lsdb,
+                const std::set<ndn::Name>& changedRouters, SpfThreadPool* threadPool = nullptr);
+
+  /**
+   * @brief Discard the previous calculation, so that the next one is a full calculation.
+   */
+  void
+  reset();
+
+  uint64_t
+  getNFullCalculations() const
+  {
+    return m_nFullCalculations;
+  }
+
+  uint64_t
+  getNIncrementalCalculations() const
+  {
+    return m_nIncrementalCalculations;
+  }
+
+private:
+  struct ShortestPathTree
+  {
+    /// Neighbor the source router is restricted to, or -1 if all its links are used.
+    int32_t neighbor;
+    std::vector<int> parent;
+    std::vector<double> distance;
+  };
+
+  void
+  calculateFull(const ConfParameter& confParam, const LsdbSnapshot& lsdb, bool isMultiPath,
+                SpfThreadPool* threadPool);
+
+  bool
+  repair(const ConfParameter& confParam, const LsdbSnapshot& lsdb,
+         const std::set<ndn::Name>& changedRouters, SpfThreadPool* threadPool);
+
+private:
+  /// Mapping numbers of known routers never change until the next full calculation.
+  NameMap m_map;
+  std::optional<TopologyGraph> m_graph;
+  std::vector<ShortestPathTree> m_trees;
+  int32_t m_sourceRouter = -1;
+  bool m_isMultiPath = false;
+
+  uint64_t m_nFullCalculations = 0;
+  uint64_t m_nIncrementalCalculations = 0;
+};
 
 void
-calculateHyperbolicRoutingPath(NameMap& map, RoutingTable& rt, Lsdb& lsdb,
-                               AdjacencyList& adjacencies, ndn::Name thisRouterName,
+calculateHyperbolicRoutingPath(NameMap& map, RoutingTableStatus& rt, const LsdbSnapshot& lsdb,
+                               const AdjacencyList& adjacencies, ndn::Name thisRouterName,
                                bool isDryRun);
 
 } // namespace nlsr
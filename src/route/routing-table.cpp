@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California
  *
  * This file is part of NLSR (Named-data Link State Routing).
@@ -28,12 +28,16 @@
 #include "nlsr.hpp"
 #include "tlv-nlsr.hpp"
 
+#include <boost/asio/post.hpp>
+
 namespace nlsr {
 
 INIT_LOGGER(route.RoutingTable);
 
-RoutingTable::RoutingTable(ndn::Scheduler& scheduler, Lsdb& lsdb, ConfParameter& confParam)
-  : m_scheduler(scheduler)
+RoutingTable::RoutingTable(boost::asio::io_context& io, ndn::Scheduler& scheduler, Lsdb& lsdb,
+                           ConfParameter& confParam)
+  : m_io(io)
+  , m_scheduler(scheduler)
   , m_lsdb(lsdb)
   , m_routingCalcInterval{confParam.getRoutingCalcInterval()}
   , m_isRoutingTableCalculating(false)
@@ -58,7 +62,7 @@ RoutingTable::RoutingTable(ndn::Scheduler& scheduler, Lsdb& lsdb, ConfParameter&
         clearRoutingTable();
         clearDryRoutingTable();
         NLSR_LOG_DEBUG("Calling Update NPT With new Route");
-        afterRoutingChange(m_rTable);
+        afterRoutingChange(getRoutingTableEntry());
         NLSR_LOG_DEBUG(*this);
         m_ownAdjLsaExist = false;
       }
@@ -67,6 +71,11 @@ RoutingTable::RoutingTable(ndn::Scheduler& scheduler, Lsdb& lsdb, ConfParameter&
         m_ownAdjLsaExist = true;
       }
 
+      // Removals are recorded as well, so that the next calculation takes them into account
+      if (type == Lsa::Type::ADJACENCY && m_confParam.isIncrementalSpfEnabled()) {
+        m_changedAdjLsaRouters.insert(lsa->getOriginRouter());
+      }
+
       // Don;t do anything on removal, wait for HelloProtocol to confirm and then react
       if (updateType == LsdbUpdate::INSTALLED || updateType == LsdbUpdate::UPDATED) {
         if ((type == Lsa::Type::ADJACENCY  && m_hyperbolicState != HYPERBOLIC_STATE_ON) ||
@@ -82,6 +91,15 @@ RoutingTable::RoutingTable(ndn::Scheduler& scheduler, Lsdb& lsdb, ConfParameter&
   );
 }
 
+RoutingTable::~RoutingTable()
+{
+  m_afterLsdbModified.disconnect();
+  // Wait for a calculation in progress, as it refers to members of this RoutingTable
+  if (m_calculationThread != nullptr) {
+    m_calculationThread->join();
+  }
+}
+
 void
 RoutingTable::calculate()
 {
@@ -91,74 +109,148 @@ RoutingTable::calculate()
   if (m_isRoutingTableCalculating == false) {
     m_isRoutingTableCalculating = true;
 
-    if (m_hyperbolicState == HYPERBOLIC_STATE_OFF) {
-      calculateLsRoutingTable();
-    }
-    else if (m_hyperbolicState == HYPERBOLIC_STATE_DRY_RUN) {
-      calculateLsRoutingTable();
-      calculateHypRoutingTable(true);
+    auto calculation = prepareCalculation();
+    if (calculation != nullptr) {
+      ++m_nCalculations;
+      NLSR_LOG_DEBUG("Routing table calculations: " << m_nCalculations
+                     << ", suppressed: " << m_nSuppressedCalculations);
     }
-    else if (m_hyperbolicState == HYPERBOLIC_STATE_ON) {
-      calculateHypRoutingTable(false);
+    if (calculation == nullptr || !m_confParam.isRoutingCalcInBackground()) {
+      if (calculation != nullptr) {
+        performCalculation(*calculation);
+        finishCalculation(*calculation);
+      }
+      m_isRouteCalculationScheduled = false;
+      m_isRoutingTableCalculating = false;
+      if (m_isCalculationPending) {
+        m_isCalculationPending = false;
+        scheduleRoutingTableCalculation();
+      }
+      return;
     }
 
+    // LSDB changes during the calculation will schedule another one
     m_isRouteCalculationScheduled = false;
-    m_isRoutingTableCalculating = false;
+    if (m_calculationThread == nullptr) {
+      m_calculationThread = std::make_unique<boost::asio::thread_pool>(1);
+    }
+    NLSR_LOG_DEBUG("Calculating routing table in background");
+    boost::asio::post(*m_calculationThread,
+      [this, calculation, isAlive = std::weak_ptr<bool>(m_isAlive)] {
+        performCalculation(*calculation);
+        boost::asio::post(m_io, [this, calculation, isAlive] {
+          if (isAlive.expired()) {
+            return;
+          }
+          finishCalculation(*calculation);
+          m_isRoutingTableCalculating = false;
+          // A calculation whose wait has elapsed meanwhile starts right away
+          if (m_isCalculationPending) {
+            m_isCalculationPending = false;
+            calculate();
+          }
+        });
+      });
   }
   else {
-    scheduleRoutingTableCalculation();
+    // This calculation is no longer scheduled; it runs when the one in progress completes
+    m_isRouteCalculationScheduled = false;
+    m_isCalculationPending = true;
   }
 }
 
-void
-RoutingTable::calculateLsRoutingTable()
+std::shared_ptr<RoutingTable::Calculation>
+RoutingTable::prepareCalculation()
 {
-  NLSR_LOG_TRACE("CalculateLsRoutingTable Called");
+  auto calculation = std::make_shared<Calculation>();
 
-  if (m_lsdb.getIsBuildAdjLsaScheduled()) {
-    NLSR_LOG_DEBUG("Adjacency build is scheduled, routing table can not be calculated :(");
-    return;
+  if (m_hyperbolicState != HYPERBOLIC_STATE_ON) {
+    NLSR_LOG_TRACE("CalculateLsRoutingTable Called");
+    if (m_lsdb.getIsBuildAdjLsaScheduled()) {
+      NLSR_LOG_DEBUG("Adjacency build is scheduled, routing table can not be calculated :(");
+    }
+    // We only check this in LS since we never remove our own Coordinate LSA,
+    // whereas we remove our own Adjacency LSA if we don't have any neighbors
+    else if (m_ownAdjLsaExist) {
+      calculation->isLinkState = true;
+    }
   }
-
-  // We only check this in LS since we never remove our own Coordinate LSA,
-  // whereas we remove our own Adjacency LSA if we don't have any neighbors
-  if (!m_ownAdjLsaExist) {
-    return;
+  if (m_hyperbolicState != HYPERBOLIC_STATE_OFF) {
+    calculation->isHyperbolic = true;
+    calculation->isHyperbolicDryRun = m_hyperbolicState == HYPERBOLIC_STATE_DRY_RUN;
   }
 
-  clearRoutingTable();
-
-  auto lsaRange = m_lsdb.getLsdbIterator<AdjLsa>();
-  auto map = NameMap::createFromAdjLsdb(lsaRange.first, lsaRange.second);
-  NLSR_LOG_DEBUG(map);
+  if (!calculation->isLinkState && !calculation->isHyperbolic) {
+    return nullptr;
+  }
 
-  calculateLinkStateRoutingPath(map, *this, m_confParam, m_lsdb);
+  // The threads are started for the first calculation and reused by the following ones
+  if (calculation->isLinkState && m_spfThreadPool == nullptr) {
+    m_spfThreadPool = std::make_unique<SpfThreadPool>(m_confParam.getSpfThreads());
+  }
 
-  NLSR_LOG_DEBUG("Calling Update NPT With new Route");
-  afterRoutingChange(m_rTable);
-  NLSR_LOG_DEBUG(*this);
+  calculation->lsdb = m_lsdb.getSnapshot();
+  calculation->adjacencies = m_confParam.getAdjacencyList();
+  if (calculation->isLinkState) {
+    calculation->changedRouters.swap(m_changedAdjLsaRouters);
+  }
+  return calculation;
 }
 
 void
-RoutingTable::calculateHypRoutingTable(bool isDryRun)
+RoutingTable::performCalculation(Calculation& calculation)
 {
-  if (isDryRun) {
-    clearDryRoutingTable();
+  if (calculation.isLinkState) {
+    if (m_confParam.isIncrementalSpfEnabled()) {
+      m_incrementalCalculator.calculatePath(calculation.result, m_confParam,
+                                            calculation.adjacencies, *calculation.lsdb,
+                                            calculation.changedRouters, m_spfThreadPool.get());
+      NLSR_LOG_DEBUG("Full SPF calculations: " << m_incrementalCalculator.getNFullCalculations()
+                     << ", incremental: " << m_incrementalCalculator.getNIncrementalCalculations());
+    }
+    else {
+      auto lsaRange = calculation.lsdb->getLsdbIterator<AdjLsa>();
+      auto map = NameMap::createFromAdjLsdb(lsaRange.first, lsaRange.second);
+      NLSR_LOG_DEBUG(map);
+
+      calculateLinkStateRoutingPath(map, calculation.result, m_confParam,
+                                    calculation.adjacencies, *calculation.lsdb,
+                                    m_spfThreadPool.get());
+    }
   }
-  else {
-    clearRoutingTable();
+
+  if (calculation.isHyperbolic) {
+    auto lsaRange = calculation.lsdb->getLsdbIterator<CoordinateLsa>();
+    auto map = NameMap::createFromCoordinateLsdb(lsaRange.first, lsaRange.second);
+    NLSR_LOG_DEBUG(map);
+
+    calculateHyperbolicRoutingPath(map, calculation.result, *calculation.lsdb,
+                                   calculation.adjacencies, m_confParam.getRouterPrefix(),
+                                   calculation.isHyperbolicDryRun);
   }
+}
 
-  auto lsaRange = m_lsdb.getLsdbIterator<CoordinateLsa>();
-  auto map = NameMap::createFromCoordinateLsdb(lsaRange.first, lsaRange.second);
-  NLSR_LOG_DEBUG(map);
+void
+RoutingTable::finishCalculation(const Calculation& calculation)
+{
+  if (calculation.isHyperbolicDryRun) {
+    setDryRoutingTableEntries(calculation.result.getDryRoutingTableEntry());
+    m_wire.reset();
+  }
 
-  calculateHyperbolicRoutingPath(map, *this, m_lsdb, m_confParam.getAdjacencyList(),
-                                 m_confParam.getRouterPrefix(), isDryRun);
+  bool isRoutingTableCalculated = calculation.isLinkState ||
+                                  (calculation.isHyperbolic && !calculation.isHyperbolicDryRun);
+  // Own Adjacency LSA may have been removed while calculating in background
+  if (calculation.isLinkState && !m_ownAdjLsaExist) {
+    NLSR_LOG_DEBUG("No Adj LSA of router itself, discarding calculated routing table");
+    isRoutingTableCalculated = false;
+  }
 
-  if (!isDryRun) {
+  if (isRoutingTableCalculated) {
+    setRoutingTableEntries(calculation.result.getRoutingTableEntry());
+    m_wire.reset();
     NLSR_LOG_DEBUG("Calling Update NPT With new Route");
-    afterRoutingChange(m_rTable);
+    afterRoutingChange(getRoutingTableEntry());
     NLSR_LOG_DEBUG(*this);
   }
 }
@@ -167,28 +259,66 @@ void
 RoutingTable::scheduleRoutingTableCalculation()
 {
   if (!m_isRouteCalculationScheduled) {
-    NLSR_LOG_DEBUG("Scheduling routing table calculation in " << m_routingCalcInterval);
-    m_scheduler.schedule(m_routingCalcInterval, [this] { calculate(); });
+    auto delay = getCalculationDelay();
+    NLSR_LOG_DEBUG("Scheduling routing table calculation in " << delay);
+    m_scheduler.schedule(delay, [this] { calculate(); });
     m_isRouteCalculationScheduled = true;
   }
+  else {
+    ++m_nSuppressedCalculations;
+  }
+}
+
+ndn::time::milliseconds
+RoutingTable::getCalculationDelay()
+{
+  if (!m_confParam.isSpfThrottleEnabled()) {
+    return m_routingCalcInterval;
+  }
+
+  auto now = ndn::time::steady_clock::now();
+  auto maxWait = m_confParam.getSpfMaxWait();
+  ndn::time::milliseconds wait;
+  if (m_spfWait == 0_ms || now - m_lastSpfSchedule >= 2 * maxWait) {
+    wait = std::min(m_confParam.getSpfInitialWait(), maxWait);
+    m_spfWait = std::min(m_confParam.getSpfBackoffWait(), maxWait);
+  }
+  else {
+    wait = m_spfWait;
+    m_spfWait = std::min(2 * m_spfWait, maxWait);
+  }
+  m_lastSpfSchedule = now;
+  return wait;
 }
 
-static bool
-routingTableEntryCompare(RoutingTableEntry& rte, ndn::Name& destRouter)
+RoutingTableStatus::RoutingTableStatus(const RoutingTableStatus& other)
+  : m_dryTable(other.m_dryTable)
+  , m_rTable(other.m_rTable)
+  , m_wire(other.m_wire)
 {
-  return rte.getDestination() == destRouter;
+  rebuildIndexes();
+}
+
+RoutingTableStatus&
+RoutingTableStatus::operator=(const RoutingTableStatus& other)
+{
+  m_dryTable = other.m_dryTable;
+  m_rTable = other.m_rTable;
+  m_wire = other.m_wire;
+  rebuildIndexes();
+  return *this;
 }
 
 void
-RoutingTable::addNextHop(const ndn::Name& destRouter, NextHop& nh)
+RoutingTableStatus::addNextHop(const ndn::Name& destRouter, NextHop& nh)
 {
   NLSR_LOG_DEBUG("Adding " << nh << " for destination: " << destRouter);
 
   RoutingTableEntry* rteChk = findRoutingTableEntry(destRouter);
   if (rteChk == nullptr) {
-    RoutingTableEntry rte(destRouter);
+    RoutingTableEntry& rte = m_rTable.emplace_back(destRouter);
     rte.getNexthopList().addNextHop(nh);
-    m_rTable.push_back(rte);
+    m_rTableIndex.emplace(destRouter, &rte);
   }
   else {
     rteChk->getNexthopList().addNextHop(nh);
@@ -197,48 +327,77 @@ RoutingTable::addNextHop(const ndn::Name& destRouter, NextHop& nh)
 }
 
 RoutingTableEntry*
-RoutingTable::findRoutingTableEntry(const ndn::Name& destRouter)
+RoutingTableStatus::findRoutingTableEntry(const ndn::Name& destRouter)
 {
-  auto it = std::find_if(m_rTable.begin(), m_rTable.end(),
-                         std::bind(&routingTableEntryCompare, _1, destRouter));
-  if (it != m_rTable.end()) {
-    return &(*it);
+  auto it = m_rTableIndex.find(destRouter);
+  if (it != m_rTableIndex.end()) {
+    return it->second;
   }
   return nullptr;
 }
 
 void
-RoutingTable::addNextHopToDryTable(const ndn::Name& destRouter, NextHop& nh)
+RoutingTableStatus::addNextHopToDryTable(const ndn::Name& destRouter, NextHop& nh)
 {
   NLSR_LOG_DEBUG("Adding " << nh << " to dry table for destination: " << destRouter);
 
-  auto it = std::find_if(m_dryTable.begin(), m_dryTable.end(),
-                         std::bind(&routingTableEntryCompare, _1, destRouter));
-  if (it == m_dryTable.end()) {
-    RoutingTableEntry rte(destRouter);
+  auto it = m_dryTableIndex.find(destRouter);
+  if (it == m_dryTableIndex.end()) {
+    RoutingTableEntry& rte = m_dryTable.emplace_back(destRouter);
     rte.getNexthopList().addNextHop(nh);
-    m_dryTable.push_back(rte);
+    m_dryTableIndex.emplace(destRouter, &rte);
   }
   else {
-    it->getNexthopList().addNextHop(nh);
+    it->second->getNexthopList().addNextHop(nh);
   }
   m_wire.reset();
 }
 
 void
-RoutingTable::clearRoutingTable()
+RoutingTableStatus::clearRoutingTable()
 {
   m_rTable.clear();
+  m_rTableIndex.clear();
   m_wire.reset();
 }
 
 void
-RoutingTable::clearDryRoutingTable()
+RoutingTableStatus::clearDryRoutingTable()
 {
   m_dryTable.clear();
+  m_dryTableIndex.clear();
   m_wire.reset();
 }
 
+void
+RoutingTableStatus::setRoutingTableEntries(const std::list<RoutingTableEntry>& entries)
+{
+  m_rTable = entries;
+  rebuildIndexes();
+  m_wire.reset();
+}
+
+void
+RoutingTableStatus::setDryRoutingTableEntries(const std::list<RoutingTableEntry>& entries)
+{
+  m_dryTable = entries;
+  rebuildIndexes();
+  m_wire.reset();
+}
+
+void
+RoutingTableStatus::rebuildIndexes()
+{
+  m_dryTableIndex.clear();
+  for (auto& entry : m_dryTable) {
+    m_dryTableIndex.emplace(entry.getDestination(), &entry);
+  }
+  m_rTableIndex.clear();
+  for (auto& entry : m_rTable) {
+    m_rTableIndex.emplace(entry.getDestination(), &entry);
+  }
+}
+
 template<ndn::encoding::Tag TAG>
 size_t
 RoutingTableStatus::wireEncode(ndn::EncodingImpl<TAG>& block) const
@@ -305,6 +464,7 @@ RoutingTableStatus::wireDecode(const ndn::Block& wire)
       m_dryTable.push_back(entry);
     }
   }
+  rebuildIndexes();
 
   if (val != m_wire.elements_end()) {
     NDN_THROW(Error("Unrecognized TLV of type " + ndn::to_string(val->type()) + " in RoutingTable"));
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2023,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California
  *
  * This file is part of NLSR (Named-data Link State Routing).
@@ -28,9 +28,14 @@
 #include "route/fib.hpp"
 #include "test-access-control.hpp"
 #include "route/name-prefix-table.hpp"
+#include "route/routing-calculator.hpp"
 
 #include <ndn-cxx/util/scheduler.hpp>
 
+#include <boost/asio/thread_pool.hpp>
+
+#include <unordered_map>
+
 namespace nlsr {
 
 class NextHop;
@@ -54,6 +59,17 @@ public:
     wireDecode(block);
   }
 
+  RoutingTableStatus(const RoutingTableStatus& other);
+
+  RoutingTableStatus&
+  operator=(const RoutingTableStatus& other);
+
+  /// Moving keeps the entries in place, so that the indexes remain valid.
+  RoutingTableStatus(RoutingTableStatus&& other) = default;
+
+  RoutingTableStatus&
+  operator=(RoutingTableStatus&& other) = default;
+
   const std::list<RoutingTableEntry>&
   getRoutingTableEntry() const
   {
@@ -69,18 +85,60 @@ public:
   const ndn::Block&
   wireEncode() const;
 
+  /*! \brief Adds a next hop to a routing table entry.
+   *  \param destRouter The destination router whose RTE we want to modify.
+   *  \param nh The next hop to add to the RTE.
+   */
+  void
+  addNextHop(const ndn::Name& destRouter, NextHop& nh);
+
+  /*! \brief Adds a next hop to a routing table entry in a dry run scenario.
+   *  \param destRouter The destination router whose RTE we want to modify.
+   *  \param nh The next hop to add to the router.
+   */
+  void
+  addNextHopToDryTable(const ndn::Name& destRouter, NextHop& nh);
+
+  RoutingTableEntry*
+  findRoutingTableEntry(const ndn::Name& destRouter);
+
+  void
+  clearRoutingTable();
+
+  void
+  clearDryRoutingTable();
+
+protected:
+  /*! \brief Replaces all entries of the routing table. */
+  void
+  setRoutingTableEntries(const std::list<RoutingTableEntry>& entries);
+
+  /*! \brief Replaces all entries of the dry run routing table. */
+  void
+  setDryRoutingTableEntries(const std::list<RoutingTableEntry>& entries);
+
 private:
   void
   wireDecode(const ndn::Block& wire);
 
+  /*! \brief Rebuilds the indexes after the tables have been replaced. */
+  void
+  rebuildIndexes();
+
   template<ndn::encoding::Tag TAG>
   size_t
   wireEncode(ndn::EncodingImpl<TAG>& block) const;
 
 PUBLIC_WITH_TESTS_ELSE_PROTECTED:
+  mutable ndn::Block m_wire;
+
+private:
+  /// Modified only through the member functions, which keep the indexes in sync.
   std::list<RoutingTableEntry> m_dryTable;
   std::list<RoutingTableEntry> m_rTable;
-  mutable ndn::Block m_wire;
+  /// Entries of m_dryTable and m_rTable by destination, for constant-time lookup.
+  std::unordered_map<ndn::Name, RoutingTableEntry*> m_dryTableIndex;
+  std::unordered_map<ndn::Name, RoutingTableEntry*> m_rTableIndex;
 };
 
 std::ostream&
@@ -89,75 +147,115 @@ operator<<(std::ostream& os, const RoutingTableStatus& rts);
 class RoutingTable : public RoutingTableStatus
 {
 public:
-  explicit
-  RoutingTable(ndn::Scheduler& scheduler, Lsdb& lsdb, ConfParameter& confParam);
+  RoutingTable(boost::asio::io_context& io, ndn::Scheduler& scheduler, Lsdb& lsdb,
+               ConfParameter& confParam);
 
-  ~RoutingTable()
-  {
-    m_afterLsdbModified.disconnect();
-  }
+  ~RoutingTable();
 
   /*! \brief Calculates a list of next hops for each router in the network.
    *
    *  Calculates the list of next hops to every other router in the network.
+   *  If routing calculation in background is enabled, the calculation runs on a worker
+   *  thread and the routing table is updated when it completes.
    */
   void
   calculate();
 
-  /*! \brief Adds a next hop to a routing table entry.
-   *  \param destRouter The destination router whose RTE we want to modify.
-   *  \param nh The next hop to add to the RTE.
+  /*! \brief Schedules a calculation event in the event scheduler only
+   *  if one isn't already scheduled.
+   *
+   *  The calculation is delayed by routing-calc-interval, or by the SPF throttle if enabled.
    */
   void
-  addNextHop(const ndn::Name& destRouter, NextHop& nh);
+  scheduleRoutingTableCalculation();
 
-  /*! \brief Adds a next hop to a routing table entry in a dry run scenario.
-   *  \param destRouter The destination router whose RTE we want to modify.
-   *  \param nh The next hop to add to the router.
+  /*! \brief Returns the number of routing table calculations performed.
    */
-  void
-  addNextHopToDryTable(const ndn::Name& destRouter, NextHop& nh);
-
-  RoutingTableEntry*
-  findRoutingTableEntry(const ndn::Name& destRouter);
+  uint64_t
+  getNCalculations() const
+  {
+    return m_nCalculations;
+  }
 
-  /*! \brief Schedules a calculation event in the event scheduler only
-   *  if one isn't already scheduled.
+  /*! \brief Returns the number of calculation requests merged into a scheduled calculation.
    */
-  void
-  scheduleRoutingTableCalculation();
+  uint64_t
+  getNSuppressedCalculations() const
+  {
+    return m_nSuppressedCalculations;
+  }
 
 private:
-  /*! \brief Calculates a link-state routing table. */
-  void
-  calculateLsRoutingTable();
+  /*! \brief Everything a routing table calculation reads and writes.
+   *
+   *  The inputs are taken when the calculation starts, so that the calculation can run on
+   *  another thread while the LSDB and the adjacency list keep changing.
+   */
+  struct Calculation
+  {
+    bool isLinkState = false;
+    bool isHyperbolic = false;
+    bool isHyperbolicDryRun = false;
+    std::shared_ptr<const LsdbSnapshot> lsdb;
+    AdjacencyList adjacencies;
+    std::set<ndn::Name> changedRouters;
+    RoutingTableStatus result;
+  };
+
+  /*! \brief Determines which routing tables to calculate and copies their inputs.
+   *  \return The calculation, or nullptr if there is nothing to calculate.
+   */
+  std::shared_ptr<Calculation>
+  prepareCalculation();
 
-  /*! \brief Calculates a HR routing table. */
+  /*! \brief Calculates routing tables; may be invoked on any thread. */
   void
-  calculateHypRoutingTable(bool isDryRun);
+  performCalculation(Calculation& calculation);
 
+  /*! \brief Installs the calculated routing tables and notifies about the change. */
   void
-  clearRoutingTable();
+  finishCalculation(const Calculation& calculation);
 
-  void
-  clearDryRoutingTable();
+  /*! \brief Returns the delay of a calculation scheduled now, and advances the SPF throttle.
+   *
+   *  The first calculation after a quiet period waits spf-initial-wait. Each further one waits
+   *  spf-backoff-wait, doubled every time up to spf-max-wait. The throttle returns to the
+   *  initial wait when no calculation has been scheduled for twice spf-max-wait.
+   */
+  ndn::time::milliseconds
+  getCalculationDelay();
 
 public:
   AfterRoutingChange afterRoutingChange;
 
 private:
+  boost::asio::io_context& m_io;
   ndn::Scheduler& m_scheduler;
   Lsdb& m_lsdb;
+  std::unique_ptr<SpfThreadPool> m_spfThreadPool;
+  /// Expires when this RoutingTable is destroyed; checked by results posted from the worker.
+  std::shared_ptr<bool> m_isAlive = std::make_shared<bool>(true);
 
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  std::unique_ptr<boost::asio::thread_pool> m_calculationThread;
   ndn::time::seconds m_routingCalcInterval;
   bool m_isRoutingTableCalculating;
   bool m_isRouteCalculationScheduled;
+  /// Whether a calculation was due while another one was in progress.
+  bool m_isCalculationPending = false;
 
   ConfParameter& m_confParam;
   ndn::signal::Connection m_afterLsdbModified;
   int32_t m_hyperbolicState;
   bool m_ownAdjLsaExist = false;
+  IncrementalLinkStateCalculator m_incrementalCalculator;
+  std::set<ndn::Name> m_changedAdjLsaRouters;
+
+  /// Wait of the next throttled calculation, or zero if the next one is the first.
+  ndn::time::milliseconds m_spfWait = 0_ms;
+  ndn::time::steady_clock::time_point m_lastSpfSchedule;
+  uint64_t m_nCalculations = 0;
+  uint64_t m_nSuppressedCalculations = 0;
 };
 
 } // namespace nlsr
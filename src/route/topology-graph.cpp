@@ -0,0 +1,113 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "topology-graph.hpp"
+#include "adjacent.hpp"
+#include "logger.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace nlsr {
+
+INIT_LOGGER(route.TopologyGraph);
+
+static bool
+compareArcEnds(const TopologyGraph::Arc& lhs, const TopologyGraph::Arc& rhs)
+{
+  return std::tie(lhs.from, lhs.to) < std::tie(rhs.from, rhs.to);
+}
+
+TopologyGraph::TopologyGraph(size_t nRouters, std::vector<Arc> arcs)
+  : m_offsets(nRouters + 1, 0)
+{
+  arcs.erase(std::remove_if(arcs.begin(), arcs.end(),
+                            [] (const Arc& arc) { return arc.from == arc.to; }),
+             arcs.end());
+  std::sort(arcs.begin(), arcs.end(), &compareArcEnds);
+  m_links.reserve(arcs.size());
+
+  // Links that do not have the same cost for both directions should
+  // have their costs corrected:
+  //
+  //   If the cost of one side of the link is NON_ADJACENT_COST (i.e. broken) or negative,
+  //   or if one side does not advertise the link at all, the link is omitted.
+  //
+  //   Otherwise, both sides of the link should use the larger of the two costs.
+  for (const auto& arc : arcs) {
+    double reverseCost = Adjacent::NON_ADJACENT_COST;
+    auto reverse = std::lower_bound(arcs.begin(), arcs.end(), Arc{arc.to, arc.from, 0},
+                                    &compareArcEnds);
+    if (reverse != arcs.end() && reverse->from == arc.to && reverse->to == arc.from) {
+      reverseCost = reverse->cost;
+    }
+
+    // If both sides of the link are up, use the larger cost else break the link
+    double correctedCost = Adjacent::NON_ADJACENT_COST;
+    if (arc.cost >= 0 && reverseCost >= 0) {
+      correctedCost = std::max(arc.cost, reverseCost);
+    }
+
+    // Warn once per link: from the lower index, or from the only side that advertises it
+    if (arc.cost != reverseCost &&
+        (arc.from < arc.to || reverseCost == Adjacent::NON_ADJACENT_COST)) {
+      NLSR_LOG_WARN("Cost between [" << arc.from << "][" << arc.to << "] and [" << arc.to <<
+                    "][" << arc.from << "] are not the same (" << arc.cost << " != " <<
+                    reverseCost << "). " << "Correcting to cost: " << correctedCost);
+    }
+
+    if (correctedCost >= 0) {
+      m_links.push_back(Link{arc.to, correctedCost});
+      ++m_offsets[arc.from + 1];
+    }
+  }
+
+  std::partial_sum(m_offsets.begin(), m_offsets.end(), m_offsets.begin());
+}
+
+double
+TopologyGraph::getLinkCost(int32_t from, int32_t to) const
+{
+  auto links = getLinks(from);
+  auto it = std::lower_bound(links.begin(), links.end(), to,
+                             [] (const Link& link, int32_t neighbor) {
+                               return link.neighbor < neighbor;
+                             });
+  if (it == links.end() || it->neighbor != to) {
+    return Adjacent::NON_ADJACENT_COST;
+  }
+  return it->cost;
+}
+
+std::ostream&
+operator<<(std::ostream& os, const TopologyGraph& graph)
+{
+  os << "---------------TopologyGraph---------------";
+  for (size_t i = 0; i < graph.size(); ++i) {
+    os << "\n" << i << "|";
+    for (const auto& link : graph.getLinks(static_cast<int32_t>(i))) {
+      os << " " << link.neighbor << ":" << link.cost;
+    }
+  }
+  return os;
+}
+
+} // namespace nlsr
@@ -0,0 +1,150 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NLSR_TOPOLOGY_GRAPH_HPP
+#define NLSR_TOPOLOGY_GRAPH_HPP
+
+#include "common.hpp"
+#include "name-map.hpp"
+#include "lsa/adj-lsa.hpp"
+
+#include <ndn-cxx/util/span.hpp>
+
+#include <boost/concept_check.hpp>
+
+#include <vector>
+
+namespace nlsr {
+
+/**
+ * @brief Link-state network topology.
+ *
+ * TopologyGraph stores the links between routers, identified by their NameMap mapping numbers,
+ * as a sparse adjacency list in compressed sparse row (CSR) format. Links of each router are
+ * stored contiguously and sorted by neighbor mapping number. Memory usage is linear in the number
+ * of routers and links.
+ *
+ * A link is present only if both of its ends advertise it with a non-negative cost. In case of a
+ * mismatch in bidirectional costs, the higher cost is assigned for both directions.
+ */
+class TopologyGraph
+{
+public:
+  struct Link
+  {
+    int32_t neighbor;
+    double cost;
+  };
+
+  /**
+   * @brief A directed link as advertised by one end.
+   */
+  struct Arc
+  {
+    int32_t from;
+    int32_t to;
+    double cost;
+  };
+
+  /**
+   * @brief Create a TopologyGraph from Adjacency LSAs.
+   * @tparam IteratorType A *LegacyInputIterator* whose value type is convertible to
+   *                      `std::shared_ptr<AdjLsa>`.
+   * @param first Range begin iterator.
+   * @param last Range past-end iterator. It must be reachable by incrementing @p first .
+   * @param map NameMap containing origin and adjacent router names in the Adjacency LSAs.
+   */
+  template<typename IteratorType>
+  static TopologyGraph
+  createFromAdjLsdb(IteratorType first, IteratorType last, const NameMap& map)
+  {
+    BOOST_CONCEPT_ASSERT((boost::InputIterator<IteratorType>));
+    std::vector<Arc> arcs;
+    for (auto it = first; it != last; ++it) {
+      // *it has type std::shared_ptr<Lsa> ; it->get() has type Lsa*
+      auto lsa = static_cast<const AdjLsa*>(it->get());
+      auto from = map.getMappingNoByRouterName(lsa->getOriginRouter());
+      if (!from) {
+        continue;
+      }
+      for (const auto& adjacent : lsa->getAdl()) {
+        auto to = map.getMappingNoByRouterName(adjacent.getName());
+        if (to) {
+          arcs.push_back(Arc{*from, *to, adjacent.getLinkCost()});
+        }
+      }
+    }
+    return TopologyGraph(map.size(), std::move(arcs));
+  }
+
+  /**
+   * @brief Create a TopologyGraph from advertised directed links.
+   * @param nRouters Number of routers; mapping numbers in @p arcs must be less than this.
+   * @param arcs Directed links. Self links are ignored.
+   */
+  TopologyGraph(size_t nRouters, std::vector<Arc> arcs);
+
+  /**
+   * @brief Return number of routers.
+   */
+  size_t
+  size() const
+  {
+    return m_offsets.size() - 1;
+  }
+
+  /**
+   * @brief Return number of bidirectional links.
+   */
+  size_t
+  getNLinks() const
+  {
+    return m_links.size() / 2;
+  }
+
+  /**
+   * @brief Return links of a router, sorted by neighbor mapping number.
+   */
+  ndn::span<const Link>
+  getLinks(int32_t router) const
+  {
+    return ndn::span<const Link>(m_links.data() + m_offsets[router],
+                                 m_offsets[router + 1] - m_offsets[router]);
+  }
+
+  /**
+   * @brief Return cost of the link between two routers.
+   * @returns Link cost, or @c Adjacent::NON_ADJACENT_COST if there is no such link.
+   */
+  double
+  getLinkCost(int32_t from, int32_t to) const;
+
+private:
+  std::vector<size_t> m_offsets;
+  std::vector<Link> m_links;
+};
+
+std::ostream&
+operator<<(std::ostream& os, const TopologyGraph& graph);
+
+} // namespace nlsr
+
+#endif // NLSR_TOPOLOGY_GRAPH_HPP
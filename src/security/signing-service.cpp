@@ -0,0 +1,171 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "signing-service.hpp"
+#include "logger.hpp"
+
+#include <ndn-cxx/util/segmenter.hpp>
+
+#include <boost/asio/post.hpp>
+
+namespace nlsr::security {
+
+INIT_LOGGER(SigningService);
+
+static bool
+isInMemory(const std::string& locator)
+{
+  auto scheme = locator.substr(0, locator.find(':'));
+  return scheme == "pib-memory" || scheme == "tpm-memory";
+}
+
+SigningService::SigningService(boost::asio::io_context& io, ndn::KeyChain& keyChain,
+                               size_t nThreads)
+  : m_io(io)
+  , m_keyChain(keyChain)
+{
+  if (nThreads == 0) {
+    return;
+  }
+
+  const auto& pibLocator = keyChain.getPib().getPibLocator();
+  auto tpmLocator = keyChain.getTpm().getTpmLocator();
+  if (isInMemory(pibLocator) || isInMemory(tpmLocator)) {
+    NLSR_LOG_WARN("In-memory KeyChain cannot be opened by signing threads, "
+                  "signing on the I/O thread");
+    return;
+  }
+
+  for (size_t i = 0; i < nThreads; ++i) {
+    m_workerKeyChains.push_back(std::make_unique<ndn::KeyChain>(pibLocator, tpmLocator));
+    m_freeKeyChains.push_back(m_workerKeyChains.back().get());
+  }
+  m_pool = std::make_unique<boost::asio::thread_pool>(nThreads);
+  m_urgentKeyChain = std::make_unique<ndn::KeyChain>(pibLocator, tpmLocator);
+  m_urgentPool = std::make_unique<boost::asio::thread_pool>(1);
+  NLSR_LOG_DEBUG("Signing with " << nThreads << " threads, and one for urgent requests");
+}
+
+SigningService::~SigningService()
+{
+  for (auto* pool : {m_pool.get(), m_urgentPool.get()}) {
+    if (pool != nullptr) {
+      pool->stop();
+      pool->join();
+    }
+  }
+}
+
+void
+SigningService::sign(std::shared_ptr<ndn::Data> data,
+                     const ndn::security::SigningInfo& signingInfo, DataCallback callback,
+                     Priority priority)
+{
+  if (m_pool == nullptr) {
+    m_keyChain.sign(*data, signingInfo);
+    callback(std::move(data));
+    return;
+  }
+
+  ++m_nPending;
+  post([this, data = std::move(data), signingInfo, callback = std::move(callback),
+        isAlive = std::weak_ptr<bool>(m_isAlive)] (ndn::KeyChain& keyChain) mutable {
+    try {
+      keyChain.sign(*data, signingInfo);
+    }
+    catch (const std::exception& e) {
+      NLSR_LOG_ERROR("Cannot sign " << data->getName() << ": " << e.what());
+      data = nullptr;
+    }
+    boost::asio::post(m_io, [this, data = std::move(data), callback = std::move(callback),
+                             isAlive = std::move(isAlive)] () mutable {
+      if (isAlive.expired()) {
+        return;
+      }
+      --m_nPending;
+      if (data != nullptr) {
+        callback(std::move(data));
+      }
+    });
+  }, priority);
+}
+
+void
+SigningService::segment(const ndn::Block& payload, const ndn::Name& dataName,
+                        size_t maxSegmentSize, ndn::time::milliseconds freshnessPeriod,
+                        const ndn::security::SigningInfo& signingInfo, SegmentsCallback callback)
+{
+  if (m_pool == nullptr) {
+    ndn::Segmenter segmenter(m_keyChain, signingInfo);
+    callback(segmenter.segment(payload, dataName, maxSegmentSize, freshnessPeriod));
+    return;
+  }
+
+  ++m_nPending;
+  post([this, payload, dataName, maxSegmentSize, freshnessPeriod, signingInfo,
+        callback = std::move(callback),
+        isAlive = std::weak_ptr<bool>(m_isAlive)] (ndn::KeyChain& keyChain) mutable {
+    std::vector<std::shared_ptr<ndn::Data>> segments;
+    try {
+      ndn::Segmenter segmenter(keyChain, signingInfo);
+      segments = segmenter.segment(payload, dataName, maxSegmentSize, freshnessPeriod);
+    }
+    catch (const std::exception& e) {
+      NLSR_LOG_ERROR("Cannot sign segments of " << dataName << ": " << e.what());
+    }
+    boost::asio::post(m_io, [this, segments = std::move(segments), callback = std::move(callback),
+                             isAlive = std::move(isAlive)] () mutable {
+      if (isAlive.expired()) {
+        return;
+      }
+      --m_nPending;
+      if (!segments.empty()) {
+        callback(std::move(segments));
+      }
+    });
+  }, Priority::NORMAL);
+}
+
+void
+SigningService::post(std::function<void(ndn::KeyChain&)> task, Priority priority)
+{
+  if (priority == Priority::URGENT) {
+    boost::asio::post(*m_urgentPool, [this, task = std::move(task)] { task(*m_urgentKeyChain); });
+    return;
+  }
+
+  boost::asio::post(*m_pool, [this, task = std::move(task)] {
+    ndn::KeyChain* keyChain = nullptr;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      // There are as many KeyChains as worker threads, so one is always free
+      keyChain = m_freeKeyChains.back();
+      m_freeKeyChains.pop_back();
+    }
+
+    task(*keyChain);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_freeKeyChains.push_back(keyChain);
+  });
+}
+
+} // namespace nlsr::security
@@ -0,0 +1,126 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NLSR_SIGNING_SERVICE_HPP
+#define NLSR_SIGNING_SERVICE_HPP
+
+#include <ndn-cxx/data.hpp>
+#include <ndn-cxx/security/key-chain.hpp>
+#include <ndn-cxx/security/signing-info.hpp>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/thread_pool.hpp>
+#include <boost/noncopyable.hpp>
+
+#include <mutex>
+
+namespace nlsr::security {
+
+/*! \brief Signs Data packets on a pool of worker threads.
+ *
+ * Each worker thread signs with its own KeyChain, opened on the same PIB and TPM as the
+ * KeyChain of the I/O thread, since a KeyChain cannot be used by several threads at once.
+ * Completion callbacks are posted back to the io_context, and are not invoked once the
+ * SigningService has been destroyed.
+ *
+ * Urgent requests, such as hello replies, are signed by one more thread with a KeyChain of its
+ * own, so that they never wait behind the segmentation of large LSAs.
+ *
+ * If no worker thread is requested, or the KeyChain is kept in memory and thus cannot be
+ * opened again, packets are signed on the calling thread and the callbacks are invoked before
+ * the signing functions return.
+ */
+class SigningService : boost::noncopyable
+{
+public:
+  using DataCallback = std::function<void(std::shared_ptr<ndn::Data>)>;
+  using SegmentsCallback = std::function<void(std::vector<std::shared_ptr<ndn::Data>>)>;
+
+  enum class Priority {
+    /// Signed by the worker threads, in the order of the requests
+    NORMAL,
+    /// Signed by the thread reserved for urgent requests
+    URGENT,
+  };
+
+  SigningService(boost::asio::io_context& io, ndn::KeyChain& keyChain, size_t nThreads);
+
+  /*! \brief Waits for the signing in progress; queued packets are abandoned.
+   */
+  ~SigningService();
+
+  /*! \brief Returns whether packets are signed on worker threads.
+   */
+  bool
+  isInBackground() const
+  {
+    return m_pool != nullptr;
+  }
+
+  /*! \brief Returns the number of signing requests whose callback has not been invoked yet.
+   */
+  size_t
+  getNPending() const
+  {
+    return m_nPending;
+  }
+
+  /*! \brief Signs \p data and passes it to \p callback on the I/O thread.
+   */
+  void
+  sign(std::shared_ptr<ndn::Data> data, const ndn::security::SigningInfo& signingInfo,
+       DataCallback callback, Priority priority = Priority::NORMAL);
+
+  /*! \brief Splits \p payload into signed segments, as ndn::Segmenter::segment() does, and
+   *         passes them to \p callback on the I/O thread.
+   */
+  void
+  segment(const ndn::Block& payload, const ndn::Name& dataName, size_t maxSegmentSize,
+          ndn::time::milliseconds freshnessPeriod, const ndn::security::SigningInfo& signingInfo,
+          SegmentsCallback callback);
+
+private:
+  /*! \brief Runs \p task on a worker thread with a KeyChain of its own.
+   */
+  void
+  post(std::function<void(ndn::KeyChain&)> task, Priority priority);
+
+private:
+  boost::asio::io_context& m_io;
+  ndn::KeyChain& m_keyChain;
+
+  std::mutex m_mutex;
+  std::vector<std::unique_ptr<ndn::KeyChain>> m_workerKeyChains;
+  /// KeyChains not used by a worker thread at the moment; guarded by m_mutex.
+  std::vector<ndn::KeyChain*> m_freeKeyChains;
+  std::unique_ptr<boost::asio::thread_pool> m_pool;
+  /// Used only by the single thread of m_urgentPool.
+  std::unique_ptr<ndn::KeyChain> m_urgentKeyChain;
+  std::unique_ptr<boost::asio::thread_pool> m_urgentPool;
+
+  size_t m_nPending = 0;
+  /// Expires when this SigningService is destroyed; checked by results posted from workers.
+  std::shared_ptr<bool> m_isAlive = std::make_shared<bool>(true);
+};
+
+} // namespace nlsr::security
+
+#endif // NLSR_SIGNING_SERVICE_HPP
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California,
  *                           Arizona Board of Regents.
  *
@@ -48,6 +48,9 @@ SequencingManager::writeSeqNoToFile() const
   outputFile << "NameLsaSeq " << m_nameLsaSeq << "\n"
              << "AdjLsaSeq "  << m_adjLsaSeq  << "\n"
              << "CorLsaSeq "  << m_corLsaSeq;
+  for (const auto& [shard, seqNo] : m_nameLsaShardSeqs) {
+    outputFile << "\nNameLsaShardSeq " << shard << " " << seqNo;
+  }
   outputFile.close();
   std::filesystem::rename(tempPath, m_seqFileNameWithPath);
 }
@@ -65,11 +68,23 @@ SequencingManager::initiateSeqNoFromFile()
     inputFile >> seqType >> m_adjLsaSeq;
     inputFile >> seqType >> m_corLsaSeq;
 
+    m_nameLsaShardSeqs.clear();
+    uint32_t shard = 0;
+    uint64_t seqNo = 0;
+    while (inputFile >> seqType >> shard >> seqNo) {
+      if (seqType == "NameLsaShardSeq" && shard != 0) {
+        m_nameLsaShardSeqs[shard] = seqNo;
+      }
+    }
+
     inputFile.close();
 
     // Increment by 10 in case last run of NLSR was not able to write to file
     // before crashing
     m_nameLsaSeq += 10;
+    for (auto& shardSeq : m_nameLsaShardSeqs) {
+      shardSeq.second += 10;
+    }
 
     // Increment the adjacency LSA seq. no. if link-state or dry HR is enabled
     if (m_hyperbolicState != HYPERBOLIC_STATE_ON) {
@@ -121,6 +136,9 @@ SequencingManager::writeLog() const
     NLSR_LOG_DEBUG("Cor LSA Seq no: " << m_corLsaSeq);
   }
   NLSR_LOG_DEBUG("Name LSA Seq no: " << m_nameLsaSeq);
+  for (const auto& [shard, seqNo] : m_nameLsaShardSeqs) {
+    NLSR_LOG_DEBUG("Name LSA shard " << shard << " Seq no: " << seqNo);
+  }
 }
 
 } // namespace nlsr
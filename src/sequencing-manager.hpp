@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2021,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California,
  *                           Arizona Board of Regents.
  *
@@ -29,6 +29,7 @@
 #include <ndn-cxx/face.hpp>
 
 #include <list>
+#include <map>
 #include <string>
 
 namespace nlsr {
@@ -39,7 +40,7 @@ public:
   SequencingManager(const std::string& filePath, int hypState);
 
   void
-  setLsaSeq(uint64_t seqNo, Lsa::Type lsaType)
+  setLsaSeq(uint64_t seqNo, Lsa::Type lsaType, uint32_t shard = 0)
   {
     switch (lsaType) {
       case Lsa::Type::ADJACENCY:
@@ -49,7 +50,7 @@ public:
         m_corLsaSeq = seqNo;
         break;
       case Lsa::Type::NAME:
-        m_nameLsaSeq = seqNo;
+        setNameLsaSeq(seqNo, shard);
         break;
       default:
         return;
@@ -57,7 +58,7 @@ public:
   }
 
   uint64_t
-  getLsaSeq(Lsa::Type lsaType)
+  getLsaSeq(Lsa::Type lsaType, uint32_t shard = 0)
   {
     switch (lsaType) {
       case Lsa::Type::ADJACENCY:
@@ -65,22 +66,47 @@ public:
       case Lsa::Type::COORDINATE:
         return m_corLsaSeq;
       case Lsa::Type::NAME:
-        return m_nameLsaSeq;
+        return getNameLsaSeq(shard);
       default:
         return 0;
     }
   }
 
   uint64_t
-  getNameLsaSeq() const
+  getNameLsaSeq(uint32_t shard = 0) const
   {
-    return m_nameLsaSeq;
+    if (shard == 0) {
+      return m_nameLsaSeq;
+    }
+    auto it = m_nameLsaShardSeqs.find(shard);
+    return it != m_nameLsaShardSeqs.end() ? it->second : 0;
+  }
+
+  void
+  setNameLsaSeq(uint64_t nlsn, uint32_t shard = 0)
+  {
+    if (shard == 0) {
+      m_nameLsaSeq = nlsn;
+    }
+    else {
+      m_nameLsaShardSeqs[shard] = nlsn;
+    }
+  }
+
+  /*! \brief Returns the sequence numbers of the Name LSA shards other than shard 0.
+   */
+  const std::map<uint32_t, uint64_t>&
+  getNameLsaShardSeqs() const
+  {
+    return m_nameLsaShardSeqs;
   }
 
+  /*! \brief Forgets the sequence number of a Name LSA shard that is no longer originated.
+   */
   void
-  setNameLsaSeq(uint64_t nlsn)
+  eraseNameLsaShard(uint32_t shard)
   {
-    m_nameLsaSeq = nlsn;
+    m_nameLsaShardSeqs.erase(shard);
   }
 
   uint64_t
@@ -108,9 +134,9 @@ public:
   }
 
   void
-  increaseNameLsaSeq()
+  increaseNameLsaSeq(uint32_t shard = 0)
   {
-    m_nameLsaSeq++;
+    setNameLsaSeq(getNameLsaSeq(shard) + 1, shard);
   }
 
   void
@@ -149,6 +175,8 @@ private:
   uint64_t m_nameLsaSeq = 0;
   uint64_t m_adjLsaSeq = 0;
   uint64_t m_corLsaSeq = 0;
+  /// Sequence numbers of the Name LSA shards other than shard 0.
+  std::map<uint32_t, uint64_t> m_nameLsaShardSeqs;
   std::string m_seqFileNameWithPath;
 
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
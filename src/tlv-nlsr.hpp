@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California,
  *                           Arizona Board of Regents.
  *
@@ -46,7 +46,24 @@ enum {
   NextHop                     = 143,
   RoutingTable                = 144,
   RoutingTableEntry           = 145,
-  PrefixInfo                  = 146
+  PrefixInfo                  = 146,
+  TimerStatus                 = 147,
+  NPendingTimers              = 148,
+  NExpiredTimers              = 149,
+  NCancelledTimers            = 150,
+  NameLsaDelta                = 151,
+  BaseSequenceNumber          = 152,
+  NameLsaShard                = 153,
+  CompactNameLsa              = 154,
+  CompactPrefixInfo           = 155,
+  SharedComponents            = 156,
+  LsdbStatusFilter            = 157,
+  LsdbVersion                 = 158,
+  RemovedLsa                  = 159,
+  LsdbEvent                   = 160,
+  LsdbEventKind               = 161,
+  LsaType                     = 162,
+  RoutingTableEvent           = 163
 };
 
 } // namespace nlsr::tlv
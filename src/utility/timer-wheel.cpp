@@ -0,0 +1,207 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "timer-wheel.hpp"
+
+#include <algorithm>
+
+namespace nlsr::util {
+
+TimerWheel::TimerWheel(ndn::Scheduler& scheduler, ndn::time::nanoseconds tickInterval,
+                       size_t nSlots)
+  : m_scheduler(scheduler)
+  , m_tickInterval(tickInterval)
+  , m_epoch(ndn::time::steady_clock::now())
+  , m_slots(nSlots, NIL)
+{
+  BOOST_ASSERT(tickInterval > ndn::time::nanoseconds::zero());
+  BOOST_ASSERT(nSlots > 0);
+}
+
+TimerWheel::EventId
+TimerWheel::schedule(ndn::time::nanoseconds delay, Callback callback)
+{
+  if (m_nPending == 0) {
+    // Slots passed while the wheel was empty do not need to be processed
+    m_lastTick = std::max(m_lastTick, getCurrentTick());
+  }
+
+  auto deadline = ndn::time::steady_clock::now() - m_epoch +
+                  std::max(delay, ndn::time::nanoseconds::zero());
+  // Round up, so that a timer never expires early
+  uint64_t tick = (deadline.count() + m_tickInterval.count() - 1) / m_tickInterval.count();
+
+  uint32_t index = allocate();
+  Timer& timer = m_timers[index];
+  timer.callback = std::move(callback);
+  timer.tick = std::max(tick, m_lastTick + 1);
+  link(index);
+  ++m_nPending;
+
+  if (!m_isTickScheduled) {
+    scheduleTick();
+  }
+  return {index, timer.generation};
+}
+
+void
+TimerWheel::cancel(const EventId& eventId)
+{
+  if (!isPending(eventId)) {
+    return;
+  }
+
+  if (m_timers[eventId.m_index].state == State::LINKED) {
+    unlink(eventId.m_index);
+  }
+  release(eventId.m_index);
+  --m_nPending;
+  ++m_nCancelled;
+}
+
+bool
+TimerWheel::isPending(const EventId& eventId) const
+{
+  return eventId.m_index < m_timers.size() &&
+         m_timers[eventId.m_index].generation == eventId.m_generation &&
+         m_timers[eventId.m_index].state != State::FREE;
+}
+
+uint64_t
+TimerWheel::getCurrentTick() const
+{
+  return (ndn::time::steady_clock::now() - m_epoch) / m_tickInterval;
+}
+
+uint32_t
+TimerWheel::allocate()
+{
+  if (m_freeTimers.empty()) {
+    m_timers.emplace_back();
+    return static_cast<uint32_t>(m_timers.size() - 1);
+  }
+  uint32_t index = m_freeTimers.back();
+  m_freeTimers.pop_back();
+  return index;
+}
+
+void
+TimerWheel::release(uint32_t index)
+{
+  Timer& timer = m_timers[index];
+  timer.callback = nullptr;
+  timer.state = State::FREE;
+  // Invalidate the EventIds of this timer; generation 0 is never handed out
+  if (++timer.generation == 0) {
+    timer.generation = 1;
+  }
+  m_freeTimers.push_back(index);
+}
+
+void
+TimerWheel::link(uint32_t index)
+{
+  Timer& timer = m_timers[index];
+  uint32_t& head = m_slots[timer.tick % m_slots.size()];
+  timer.prev = NIL;
+  timer.next = head;
+  if (head != NIL) {
+    m_timers[head].prev = index;
+  }
+  head = index;
+  timer.state = State::LINKED;
+}
+
+void
+TimerWheel::unlink(uint32_t index)
+{
+  Timer& timer = m_timers[index];
+  if (timer.prev != NIL) {
+    m_timers[timer.prev].next = timer.next;
+  }
+  else {
+    m_slots[timer.tick % m_slots.size()] = timer.next;
+  }
+  if (timer.next != NIL) {
+    m_timers[timer.next].prev = timer.prev;
+  }
+  timer.prev = timer.next = NIL;
+  timer.state = State::EXPIRED;
+}
+
+void
+TimerWheel::scheduleTick()
+{
+  auto tickTime = m_epoch + m_tickInterval * static_cast<int64_t>(m_lastTick + 1);
+  auto now = ndn::time::steady_clock::now();
+  auto delay = tickTime > now ? tickTime - now : ndn::time::nanoseconds::zero();
+
+  m_isTickScheduled = true;
+  m_tickEvent = m_scheduler.schedule(delay, [this] { onTick(); });
+}
+
+void
+TimerWheel::onTick()
+{
+  m_isTickScheduled = false;
+
+  uint64_t currentTick = std::max(getCurrentTick(), m_lastTick + 1);
+  // If the wheel fell behind by more than one revolution, each slot is visited only once
+  uint64_t nTicks = std::min<uint64_t>(currentTick - m_lastTick, m_slots.size());
+
+  std::vector<std::pair<uint64_t, EventId>> expired;
+  for (uint64_t tick = currentTick - nTicks + 1; tick <= currentTick; ++tick) {
+    size_t first = expired.size();
+    uint32_t index = m_slots[tick % m_slots.size()];
+    while (index != NIL) {
+      uint32_t next = m_timers[index].next;
+      if (m_timers[index].tick <= currentTick) {
+        unlink(index);
+        expired.emplace_back(m_timers[index].tick, EventId(index, m_timers[index].generation));
+      }
+      index = next;
+    }
+    // Timers are added at the front of their slot; expire them in the order they were scheduled
+    std::reverse(expired.begin() + first, expired.end());
+  }
+  m_lastTick = currentTick;
+
+  std::stable_sort(expired.begin(), expired.end(),
+                   [] (const auto& a, const auto& b) { return a.first < b.first; });
+
+  for (const auto& [tick, eventId] : expired) {
+    // A callback may have cancelled a timer that expired on the same tick
+    if (!isPending(eventId)) {
+      continue;
+    }
+    Callback callback = std::move(m_timers[eventId.m_index].callback);
+    release(eventId.m_index);
+    --m_nPending;
+    ++m_nExpired;
+    callback();
+  }
+
+  if (m_nPending > 0 && !m_isTickScheduled) {
+    scheduleTick();
+  }
+}
+
+} // namespace nlsr::util
@@ -0,0 +1,182 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NLSR_TIMER_WHEEL_HPP
+#define NLSR_TIMER_WHEEL_HPP
+
+#include "common.hpp"
+
+#include <ndn-cxx/util/scheduler.hpp>
+#include <ndn-cxx/util/time.hpp>
+
+#include <boost/noncopyable.hpp>
+
+#include <limits>
+#include <vector>
+
+namespace nlsr::util {
+
+/**
+ * @brief Hashed timing wheel for large numbers of coarse-grained timers.
+ *
+ * Timers are kept in a circular array of slots, one slot per tick, and expire at the first
+ * tick that is not earlier than their deadline. Timers that are more than one revolution
+ * away share the slot with earlier ones and are skipped until their tick comes.
+ *
+ * Scheduling and cancelling a timer take constant time, and do not allocate memory once the
+ * timer pool has grown to the highest number of pending timers. While any timer is pending,
+ * a single ndn::Scheduler event per tick drives the wheel.
+ */
+class TimerWheel : boost::noncopyable
+{
+public:
+  using Callback = std::function<void()>;
+
+  /**
+   * @brief Identifies a scheduled timer.
+   *
+   * An EventId that is default-constructed, or whose timer has expired or been cancelled,
+   * does not identify any pending timer; cancelling it has no effect.
+   */
+  class EventId
+  {
+  public:
+    EventId() = default;
+
+  private:
+    EventId(uint32_t index, uint32_t generation)
+      : m_index(index)
+      , m_generation(generation)
+    {
+    }
+
+  private:
+    uint32_t m_index = 0;
+    uint32_t m_generation = 0;
+
+    friend class TimerWheel;
+  };
+
+  /**
+   * @param scheduler Scheduler that drives the ticks.
+   * @param tickInterval Resolution of the timers.
+   * @param nSlots Number of slots; a revolution of the wheel lasts @p nSlots ticks.
+   */
+  TimerWheel(ndn::Scheduler& scheduler, ndn::time::nanoseconds tickInterval, size_t nSlots);
+
+  /**
+   * @brief Schedule @p callback to be invoked after at least @p delay.
+   */
+  EventId
+  schedule(ndn::time::nanoseconds delay, Callback callback);
+
+  /**
+   * @brief Cancel a timer, if it is still pending.
+   */
+  void
+  cancel(const EventId& eventId);
+
+  bool
+  isPending(const EventId& eventId) const;
+
+  /**
+   * @brief Return the number of pending timers.
+   */
+  size_t
+  size() const
+  {
+    return m_nPending;
+  }
+
+  uint64_t
+  getNExpired() const
+  {
+    return m_nExpired;
+  }
+
+  uint64_t
+  getNCancelled() const
+  {
+    return m_nCancelled;
+  }
+
+private:
+  enum class State : uint8_t {
+    FREE,
+    LINKED,
+    EXPIRED,
+  };
+
+  struct Timer
+  {
+    Callback callback;
+    uint64_t tick = 0;
+    uint32_t generation = 1;
+    uint32_t prev = NIL;
+    uint32_t next = NIL;
+    State state = State::FREE;
+  };
+
+  uint64_t
+  getCurrentTick() const;
+
+  uint32_t
+  allocate();
+
+  void
+  release(uint32_t index);
+
+  void
+  link(uint32_t index);
+
+  void
+  unlink(uint32_t index);
+
+  void
+  scheduleTick();
+
+  void
+  onTick();
+
+private:
+  static constexpr uint32_t NIL = std::numeric_limits<uint32_t>::max();
+
+  ndn::Scheduler& m_scheduler;
+  const ndn::time::nanoseconds m_tickInterval;
+  const ndn::time::steady_clock::time_point m_epoch;
+
+  std::vector<Timer> m_timers;
+  std::vector<uint32_t> m_freeTimers;
+  /// Index of the first timer in each slot, or NIL.
+  std::vector<uint32_t> m_slots;
+  /// The last tick whose slot has been processed.
+  uint64_t m_lastTick = 0;
+  ndn::scheduler::ScopedEventId m_tickEvent;
+  bool m_isTickScheduled = false;
+
+  size_t m_nPending = 0;
+  uint64_t m_nExpired = 0;
+  uint64_t m_nCancelled = 0;
+};
+
+} // namespace nlsr::util
+
+#endif // NLSR_TIMER_WHEEL_HPP
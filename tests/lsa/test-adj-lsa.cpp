@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California,
  *                           Arizona Board of Regents.
  *
@@ -182,6 +182,33 @@ BOOST_AUTO_TEST_CASE(InitializeFromContent)
   BOOST_CHECK_EQUAL(adjlsa1, adjlsa2);
 }
 
+BOOST_AUTO_TEST_CASE(DecodeFromPrevious)
+{
+  AdjacencyList adjacencies;
+  Adjacent adjacency("/ndn/site/adjacency");
+  adjacency.setStatus(Adjacent::STATUS_ACTIVE);
+  adjacencies.insert(adjacency);
+  AdjLsa previous("/ndn/site/router", 12, ndn::time::system_clock::now(), adjacencies);
+  AdjLsa lsa(previous);
+
+  // A refreshed version shares the adjacency list of the previous version
+  lsa.setSeqNo(13);
+  AdjLsa refreshed(lsa.wireEncode(), previous);
+  BOOST_CHECK_EQUAL(refreshed.getSeqNo(), 13);
+  BOOST_CHECK_EQUAL(&refreshed.getAdl(), &previous.getAdl());
+
+  // Modifying a version does not affect the versions it shares its adjacency list with
+  Adjacent adjacency2("/ndn/edu/adjacency");
+  refreshed.addAdjacent(adjacency2);
+  BOOST_CHECK_EQUAL(refreshed.getAdl().size(), 2);
+  BOOST_CHECK_EQUAL(previous.getAdl().size(), 1);
+
+  // A version with other adjacencies is decoded
+  AdjLsa changed(refreshed.wireEncode(), previous);
+  BOOST_CHECK_NE(&changed.getAdl(), &previous.getAdl());
+  BOOST_CHECK_EQUAL(changed, refreshed);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace nlsr::tests
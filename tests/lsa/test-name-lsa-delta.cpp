@@ -0,0 +1,93 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "lsa/name-lsa-delta.hpp"
+#include "tlv-nlsr.hpp"
+
+#include "tests/boost-test.hpp"
+
+namespace nlsr::tests {
+
+class NameLsaDeltaFixture
+{
+public:
+  NameLsaDeltaFixture()
+  {
+    base.addName(PrefixInfo("/name1", 0));
+    base.addName(PrefixInfo("/name2", 0));
+
+    NameLsa added(router, 14, expiration, NamePrefixList());
+    added.addName(PrefixInfo("/name3", 5));
+    delta = NameLsaDelta(12, added, {"/name1"});
+  }
+
+public:
+  ndn::Name router{"/router1"};
+  ndn::time::system_clock::time_point expiration = ndn::time::system_clock::now();
+  NameLsa base{router, 12, expiration, NamePrefixList()};
+  NameLsaDelta delta;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestNameLsaDelta, NameLsaDeltaFixture)
+
+BOOST_AUTO_TEST_CASE(EncodeDecode)
+{
+  auto wire = delta.wireEncode();
+  BOOST_CHECK_EQUAL(wire.type(), nlsr::tlv::NameLsaDelta);
+
+  NameLsaDelta decoded(wire);
+  BOOST_CHECK_EQUAL(decoded.getBaseSeqNo(), 12);
+  BOOST_CHECK_EQUAL(decoded.getAdded().getSeqNo(), 14);
+  BOOST_CHECK_EQUAL(decoded.getAdded().getNpl(), delta.getAdded().getNpl());
+  BOOST_CHECK(decoded.getRemoved() == std::list<ndn::Name>{"/name1"});
+  BOOST_CHECK_EQUAL(decoded.wireEncode(), wire);
+
+  BOOST_CHECK_THROW(NameLsaDelta(base.wireEncode()), NameLsaDelta::Error);
+}
+
+BOOST_AUTO_TEST_CASE(Apply)
+{
+  auto lsa = delta.apply(base);
+  BOOST_CHECK_EQUAL(lsa->getOriginRouter(), router);
+  BOOST_CHECK_EQUAL(lsa->getSeqNo(), 14);
+
+  NamePrefixList expected;
+  expected.insert("/name2");
+  expected.insert("/name3", "", 5);
+  BOOST_CHECK_EQUAL(lsa->getNpl(), expected);
+
+  // The base version is left unchanged
+  BOOST_CHECK_EQUAL(base.getSeqNo(), 12);
+  BOOST_CHECK_EQUAL(base.getNpl().size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(WrongBase)
+{
+  NameLsa other(router, 13, expiration, base.getNpl());
+  BOOST_CHECK_THROW(delta.apply(other), std::invalid_argument);
+
+  NameLsa otherRouter("/router2", 12, expiration, base.getNpl());
+  BOOST_CHECK_THROW(delta.apply(otherRouter), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace nlsr::tests
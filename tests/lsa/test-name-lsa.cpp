@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California,
  *                           Arizona Board of Regents.
  *
@@ -21,6 +21,7 @@
 
 #include "lsa/name-lsa.hpp"
 #include "name-prefix-list.hpp"
+#include "tlv-nlsr.hpp"
 
 #include "ndn-cxx/encoding/buffer-stream.hpp"
 
@@ -233,6 +234,118 @@ BOOST_AUTO_TEST_CASE(Update)
   BOOST_CHECK(it != namesToAdd.end());
 }
 
+BOOST_AUTO_TEST_CASE(Shard)
+{
+  NameLsa lsa(ndn::Name("/router1"), 12, ndn::time::system_clock::now() + 10_s,
+              NamePrefixList{ndn::Name("/name1")});
+  BOOST_CHECK_EQUAL(lsa.getShard(), 0);
+  auto wire = lsa.wireEncode();
+
+  lsa.setShard(3);
+  BOOST_CHECK_EQUAL(lsa.getShard(), 3);
+  // The shard number of shard 0 is not encoded, so its encoding is unchanged
+  BOOST_CHECK_GT(lsa.wireEncode().size(), wire.size());
+
+  NameLsa decoded(lsa.wireEncode());
+  BOOST_CHECK_EQUAL(decoded.getShard(), 3);
+  BOOST_CHECK(decoded.getNpl() == lsa.getNpl());
+
+  decoded.wireDecode(wire);
+  BOOST_CHECK_EQUAL(decoded.getShard(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(TypeComponent)
+{
+  BOOST_CHECK_EQUAL(makeLsaTypeComponent(Lsa::Type::NAME), "NAME");
+  BOOST_CHECK_EQUAL(makeLsaTypeComponent(Lsa::Type::NAME, 3), "NAME-3");
+  BOOST_CHECK_EQUAL(makeLsaTypeComponent(Lsa::Type::ADJACENCY), "ADJACENCY");
+
+  auto parse = [] (const std::string& str) {
+    return parseLsaTypeComponent(ndn::name::Component(str));
+  };
+  BOOST_CHECK(parse("NAME") == std::make_pair(Lsa::Type::NAME, 0U));
+  BOOST_CHECK(parse("NAME-3") == std::make_pair(Lsa::Type::NAME, 3U));
+  BOOST_CHECK(parse("ADJACENCY") == std::make_pair(Lsa::Type::ADJACENCY, 0U));
+  BOOST_CHECK(parse("ADJACENCY-3").first == Lsa::Type::BASE);
+  BOOST_CHECK(parse("NAME-").first == Lsa::Type::BASE);
+  BOOST_CHECK(parse("NAME-x").first == Lsa::Type::BASE);
+  BOOST_CHECK(parse("NAME-99999999999").first == Lsa::Type::BASE);
+}
+
+BOOST_AUTO_TEST_CASE(CompactEncoding)
+{
+  NameLsa lsa(ndn::Name("/router1"), 12, ndn::time::system_clock::now() + 10_s, NamePrefixList());
+  for (int i = 0; i < 10; ++i) {
+    lsa.addName(PrefixInfo(ndn::Name("/ndn/edu/ucla/cs").appendNumber(i).append("video"), 0));
+  }
+  lsa.addName(PrefixInfo(ndn::Name("/ndn/edu/ucla"), 2.5));
+  lsa.addName(PrefixInfo(ndn::Name("/ndn/edu/arizona/cs"), 2.5));
+  lsa.addName(PrefixInfo(ndn::Name("/yoursunny"), 0));
+  lsa.setShard(2);
+  auto fullWire = lsa.wireEncode();
+  BOOST_CHECK_EQUAL(fullWire.type(), nlsr::tlv::NameLsa);
+
+  lsa.setCompact(true);
+  auto compactWire = lsa.wireEncode();
+  BOOST_CHECK_EQUAL(compactWire.type(), nlsr::tlv::CompactNameLsa);
+  BOOST_CHECK_LT(compactWire.size(), fullWire.size() / 2);
+
+  NameLsa decoded(compactWire);
+  BOOST_CHECK(decoded.isCompact());
+  BOOST_CHECK_EQUAL(decoded.getShard(), 2);
+  BOOST_CHECK_EQUAL(decoded.getSeqNo(), 12);
+  BOOST_CHECK(decoded.getNpl() == lsa.getNpl());
+  BOOST_CHECK_EQUAL(decoded.getNpl().getPrefixInfoForName("/ndn/edu/ucla").getCost(), 2.5);
+  BOOST_CHECK_EQUAL(decoded.getNpl().getPrefixInfoForName("/yoursunny").getCost(), 0);
+
+  // Both encodings are decoded by the same NameLsa
+  decoded.wireDecode(fullWire);
+  BOOST_CHECK(!decoded.isCompact());
+  BOOST_CHECK(decoded.getNpl() == lsa.getNpl());
+
+  // A prefix cannot share more components than the previous prefix has
+  ndn::Block info(nlsr::tlv::CompactPrefixInfo);
+  info.push_back(ndn::makeNonNegativeIntegerBlock(nlsr::tlv::SharedComponents, 1));
+  info.push_back(ndn::Name("/a").wireEncode());
+  info.encode();
+  compactWire.parse();
+  ndn::Block invalid(nlsr::tlv::CompactNameLsa);
+  invalid.push_back(*compactWire.elements_begin());
+  invalid.push_back(info);
+  invalid.encode();
+  BOOST_CHECK_THROW(NameLsa{invalid}, NameLsa::Error);
+}
+
+BOOST_AUTO_TEST_CASE(DecodeFromPrevious)
+{
+  NameLsa previous(ndn::Name("/router1"), 12, ndn::time::system_clock::now() + 10_s,
+                   NamePrefixList{ndn::Name("/name1"), ndn::Name("/name2")});
+  NameLsa lsa(previous);
+  BOOST_CHECK_EQUAL(&lsa.getNpl(), &previous.getNpl());
+
+  // A refreshed version shares the prefix list of the previous version
+  lsa.setSeqNo(13);
+  NameLsa refreshed(lsa.wireEncode(), previous);
+  BOOST_CHECK_EQUAL(refreshed.getSeqNo(), 13);
+  BOOST_CHECK_EQUAL(&refreshed.getNpl(), &previous.getNpl());
+  BOOST_CHECK(!std::get<0>(previous.update(std::make_shared<NameLsa>(refreshed))));
+
+  // Modifying a version does not affect the versions it shares its prefix list with
+  refreshed.addName(PrefixInfo(ndn::Name("/name3"), 0));
+  BOOST_CHECK_EQUAL(refreshed.getNpl().size(), 3);
+  BOOST_CHECK_EQUAL(previous.getNpl().size(), 2);
+
+  // A version with other prefixes, or another encoding, is decoded
+  NameLsa changed(refreshed.wireEncode(), previous);
+  BOOST_CHECK_NE(&changed.getNpl(), &previous.getNpl());
+  BOOST_CHECK_EQUAL(changed.getNpl().size(), 3);
+
+  lsa.setCompact(true);
+  NameLsa compact(lsa.wireEncode(), previous);
+  BOOST_CHECK_NE(&compact.getNpl(), &previous.getNpl());
+  BOOST_CHECK(compact.getNpl() == previous.getNpl());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace nlsr::tests
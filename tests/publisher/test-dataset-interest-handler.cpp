@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California,
  *                           Arizona Board of Regents.
  *
@@ -67,6 +67,15 @@ BOOST_AUTO_TEST_CASE(Localhost)
   // Request Routing Table
   face.receive(ndn::Interest("/localhost/nlsr/routing-table").setCanBePrefix(true));
   processDatasetInterest([] (const ndn::Block& block) { return block.type() == nlsr::tlv::RoutingTable; });
+
+  // Request timer status
+  face.receive(ndn::Interest("/localhost/nlsr/timers").setCanBePrefix(true));
+  processDatasetInterest([] (const ndn::Block& block) {
+    block.parse();
+    return block.type() == nlsr::tlv::TimerStatus &&
+           block.get(nlsr::tlv::NPendingTimers).type() == nlsr::tlv::NPendingTimers &&
+           ndn::encoding::readNonNegativeInteger(block.get(nlsr::tlv::NPendingTimers)) >= 2;
+  });
 }
 
 BOOST_AUTO_TEST_CASE(RouterName)
@@ -115,6 +124,98 @@ BOOST_AUTO_TEST_CASE(RouterName)
   processDatasetInterest([] (const auto& block) { return block.type() == nlsr::tlv::RoutingTable; });
 }
 
+BOOST_AUTO_TEST_CASE(FilteredLsaStatus)
+{
+  const ndn::Name datasetName("/localhost/nlsr/lsdb/names");
+  auto fetch = [&] (std::optional<ndn::Name> router, std::optional<uint64_t> sinceVersion) {
+    ndn::Block filter(nlsr::tlv::LsdbStatusFilter);
+    if (router) {
+      filter.push_back(router->wireEncode());
+    }
+    if (sinceVersion) {
+      filter.push_back(ndn::encoding::makeNonNegativeIntegerBlock(nlsr::tlv::LsdbVersion,
+                                                                  *sinceVersion));
+    }
+    filter.encode();
+    face.receive(ndn::Interest(ndn::Name(datasetName).append(filter)).setCanBePrefix(true));
+    advanceClocks(30_ms);
+
+    BOOST_REQUIRE_EQUAL(face.sentData.size(), 1);
+    ndn::Block content(face.sentData[0].getContent());
+    face.sentData.clear();
+    content.parse();
+    return std::vector<ndn::Block>(content.elements_begin(), content.elements_end());
+  };
+
+  ndn::Name routerA("/RouterA");
+  ndn::Name routerB("/RouterB");
+  NamePrefixList npl{ndn::Name("/prefix1")};
+  lsdb.installLsa(std::make_shared<NameLsa>(routerA, 1, time::system_clock::now() + 3600_s, npl));
+  lsdb.installLsa(std::make_shared<NameLsa>(routerB, 1, time::system_clock::now() + 3600_s, npl));
+
+  auto elements = fetch(routerA, std::nullopt);
+  BOOST_REQUIRE_EQUAL(elements.size(), 2);
+  BOOST_CHECK_EQUAL(elements[0].type(), nlsr::tlv::LsdbVersion);
+  uint64_t version = ndn::readNonNegativeInteger(elements[0]);
+  BOOST_CHECK_EQUAL(NameLsa(elements[1]).getOriginRouter(), routerA);
+
+  // Polling again without changes returns nothing but the version, from the cache
+  auto nFills = nlsr.m_datasetHandler.m_nLsaStatusCacheFills;
+  elements = fetch(std::nullopt, version);
+  BOOST_REQUIRE_EQUAL(elements.size(), 1);
+  BOOST_CHECK_EQUAL(ndn::readNonNegativeInteger(elements[0]), version);
+  BOOST_CHECK_EQUAL(nlsr.m_datasetHandler.m_nLsaStatusCacheFills, nFills);
+
+  npl.insert(ndn::Name("/prefix2"));
+  lsdb.installLsa(std::make_shared<NameLsa>(routerB, 2, time::system_clock::now() + 3600_s, npl));
+  lsdb.removeLsa(routerA, Lsa::Type::NAME);
+
+  elements = fetch(std::nullopt, version);
+  BOOST_REQUIRE_EQUAL(elements.size(), 3);
+  BOOST_CHECK_GT(ndn::readNonNegativeInteger(elements[0]), version);
+  BOOST_CHECK_EQUAL(elements[1].type(), nlsr::tlv::RemovedLsa);
+  elements[1].parse();
+  BOOST_CHECK_EQUAL(ndn::Name(elements[1].get(ndn::tlv::Name)), routerA);
+  NameLsa updated(elements[2]);
+  BOOST_CHECK_EQUAL(updated.getOriginRouter(), routerB);
+  BOOST_CHECK_EQUAL(updated.getSeqNo(), 2);
+  BOOST_CHECK_EQUAL(nlsr.m_datasetHandler.m_nLsaStatusCacheFills, nFills + 1);
+
+  // Changes of another router are filtered out
+  elements = fetch(routerA, version);
+  BOOST_REQUIRE_EQUAL(elements.size(), 2);
+  BOOST_CHECK_EQUAL(elements[1].type(), nlsr::tlv::RemovedLsa);
+}
+
+BOOST_AUTO_TEST_CASE(FilteredLsaStatusRejected)
+{
+  auto getResponseCode = [&] (const ndn::Name& name) {
+    face.receive(ndn::Interest(name).setCanBePrefix(true));
+    advanceClocks(30_ms);
+
+    BOOST_REQUIRE_EQUAL(face.sentData.size(), 1);
+    ndn::mgmt::ControlResponse response(face.sentData[0].getContent().blockFromValue());
+    face.sentData.clear();
+    return response.getCode();
+  };
+
+  // Not an LsdbStatusFilter
+  ndn::Name name("/localhost/nlsr/lsdb/names");
+  BOOST_CHECK_EQUAL(getResponseCode(ndn::Name(name).append("filter")), 400);
+
+  // Removals since the initial version have been forgotten
+  ndn::Name router("/RouterA");
+  for (size_t i = 0; i <= REMOVED_LSA_HISTORY_SIZE; ++i) {
+    lsdb.installLsa(std::make_shared<NameLsa>(router, 1, time::system_clock::now() + 3600_s,
+                                              NamePrefixList()));
+    lsdb.removeLsa(router, Lsa::Type::NAME);
+  }
+  ndn::Block filter(nlsr::tlv::LsdbStatusFilter);
+  filter.push_back(ndn::encoding::makeNonNegativeIntegerBlock(nlsr::tlv::LsdbVersion, 0));
+  filter.encode();
+  BOOST_CHECK_EQUAL(getResponseCode(ndn::Name(name).append(filter)), 410);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace nlsr::tests
@@ -0,0 +1,151 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "publisher/notification-publisher.hpp"
+#include "tlv-nlsr.hpp"
+
+#include "tests/publisher/publisher-fixture.hpp"
+
+namespace nlsr::tests {
+
+class NotificationPublisherFixture : public PublisherFixture
+{
+public:
+  /// Returns the content of the only Data packet sent, which must be named \p name.
+  ndn::Block
+  getSentNotification(const ndn::Name& name)
+  {
+    advanceClocks(10_ms);
+    BOOST_REQUIRE_EQUAL(face.sentData.size(), 1);
+    BOOST_CHECK_EQUAL(face.sentData[0].getName(), name);
+    ndn::Block content = face.sentData[0].getContent().blockFromValue();
+    face.sentData.clear();
+    content.parse();
+    return content;
+  }
+
+public:
+  NotificationPublisher& publisher = nlsr.m_notificationPublisher;
+  NotificationStream& lsdbEvents = nlsr.m_notificationPublisher.m_lsdbEvents;
+  NotificationStream& rtEvents = nlsr.m_notificationPublisher.m_routingTableEvents;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestNotificationPublisher, NotificationPublisherFixture)
+
+BOOST_AUTO_TEST_CASE(LsdbEvents)
+{
+  BOOST_CHECK_EQUAL(lsdbEvents.getName(), "/localhost/nlsr/events/lsdb");
+  face.sentData.clear();
+  uint64_t seqNo = lsdbEvents.getNextSeqNo();
+
+  ndn::Name router("/RouterA");
+  lsdb.installLsa(std::make_shared<NameLsa>(router, 7, time::system_clock::now() + 3600_s,
+                                            NamePrefixList{ndn::Name("/prefix1")}));
+  auto event = getSentNotification(ndn::Name(lsdbEvents.getName()).appendSequenceNumber(seqNo));
+  BOOST_CHECK_EQUAL(event.type(), nlsr::tlv::LsdbEvent);
+  BOOST_CHECK_EQUAL(ndn::readNonNegativeInteger(event.get(nlsr::tlv::LsdbEventKind)),
+                    static_cast<uint64_t>(LsdbUpdate::INSTALLED));
+  BOOST_CHECK_EQUAL(ndn::readNonNegativeInteger(event.get(nlsr::tlv::LsdbVersion)),
+                    lsdb.getVersion());
+  BOOST_CHECK_EQUAL(ndn::Name(event.get(ndn::tlv::Name)), router);
+  BOOST_CHECK_EQUAL(ndn::readNonNegativeInteger(event.get(nlsr::tlv::LsaType)),
+                    static_cast<uint64_t>(Lsa::Type::NAME));
+  BOOST_CHECK_EQUAL(ndn::readNonNegativeInteger(event.get(nlsr::tlv::SequenceNumber)), 7);
+
+  // A refresh does not change the content of the LSA
+  lsdb.installLsa(std::make_shared<NameLsa>(router, 8, time::system_clock::now() + 3600_s,
+                                            NamePrefixList{ndn::Name("/prefix1")}));
+  advanceClocks(10_ms);
+  BOOST_CHECK(face.sentData.empty());
+
+  lsdb.removeLsa(router, Lsa::Type::NAME);
+  event = getSentNotification(ndn::Name(lsdbEvents.getName()).appendSequenceNumber(seqNo + 1));
+  BOOST_CHECK_EQUAL(ndn::readNonNegativeInteger(event.get(nlsr::tlv::LsdbEventKind)),
+                    static_cast<uint64_t>(LsdbUpdate::REMOVED));
+  BOOST_CHECK_EQUAL(lsdbEvents.getNextSeqNo(), seqNo + 2);
+}
+
+BOOST_AUTO_TEST_CASE(Backlog)
+{
+  for (size_t i = 0; i < NOTIFICATION_BACKLOG_SIZE + 2; ++i) {
+    lsdb.installLsa(std::make_shared<NameLsa>("/RouterA", 1, time::system_clock::now() + 3600_s,
+                                              NamePrefixList()));
+    lsdb.removeLsa("/RouterA", Lsa::Type::NAME);
+  }
+  advanceClocks(10_ms);
+  face.sentData.clear();
+  uint64_t lastSeqNo = lsdbEvents.getNextSeqNo() - 1;
+  uint64_t firstSeqNo = lastSeqNo + 1 - NOTIFICATION_BACKLOG_SIZE;
+
+  // The stream name retrieves the latest notification
+  face.receive(ndn::Interest(lsdbEvents.getName()).setCanBePrefix(true).setMustBeFresh(true));
+  getSentNotification(ndn::Name(lsdbEvents.getName()).appendSequenceNumber(lastSeqNo));
+
+  // A subscriber catches up with the notifications in the backlog
+  ndn::Name first = ndn::Name(lsdbEvents.getName()).appendSequenceNumber(firstSeqNo);
+  face.receive(ndn::Interest(first));
+  getSentNotification(first);
+
+  // An older notification is no longer available
+  face.receive(ndn::Interest(ndn::Name(lsdbEvents.getName()).appendSequenceNumber(firstSeqNo - 1)));
+  advanceClocks(10_ms);
+  BOOST_CHECK(face.sentData.empty());
+}
+
+BOOST_AUTO_TEST_CASE(RoutingTableEvents)
+{
+  BOOST_CHECK_EQUAL(rtEvents.getName(), "/localhost/nlsr/events/routing-table");
+  face.sentData.clear();
+  uint64_t seqNo = rtEvents.getNextSeqNo();
+
+  RoutingTableEntry entryA("/RouterA");
+  entryA.getNexthopList().addNextHop(createNextHop("udp4://10.0.0.1", 10));
+  RoutingTableEntry entryB("/RouterB");
+  entryB.getNexthopList().addNextHop(createNextHop("udp4://10.0.0.2", 20));
+  publisher.publishRoutingTableEvents({entryA, entryB});
+
+  auto event = getSentNotification(ndn::Name(rtEvents.getName()).appendSequenceNumber(seqNo));
+  BOOST_CHECK_EQUAL(event.type(), nlsr::tlv::RoutingTableEvent);
+  BOOST_CHECK_EQUAL(event.elements_size(), 2);
+
+  // Unchanged routes are left out, and a destination without next hops has been removed
+  RoutingTableEntry entryC("/RouterC");
+  entryC.getNexthopList().addNextHop(createNextHop("udp4://10.0.0.2", 30));
+  publisher.publishRoutingTableEvents({entryA, entryC});
+
+  event = getSentNotification(ndn::Name(rtEvents.getName()).appendSequenceNumber(seqNo + 1));
+  BOOST_REQUIRE_EQUAL(event.elements_size(), 2);
+  RoutingTableEntry added(event.elements()[0]);
+  BOOST_CHECK_EQUAL(added.getDestination(), "/RouterC");
+  BOOST_CHECK_EQUAL(added.getNexthopList().size(), 1);
+  RoutingTableEntry removed(event.elements()[1]);
+  BOOST_CHECK_EQUAL(removed.getDestination(), "/RouterB");
+  BOOST_CHECK_EQUAL(removed.getNexthopList().size(), 0);
+
+  // Nothing is published when the routing table has not changed
+  publisher.publishRoutingTableEvents({entryA, entryC});
+  advanceClocks(10_ms);
+  BOOST_CHECK(face.sentData.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace nlsr::tests
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California
  *
  * This file is part of NLSR (Named-data Link State Routing).
@@ -28,6 +28,8 @@
 #include <ndn-cxx/mgmt/nfd/control-parameters.hpp>
 #include <ndn-cxx/util/dummy-client-face.hpp>
 
+#include <algorithm>
+
 namespace nlsr::tests {
 
 static const ndn::Name router1Name = "/ndn/router1";
@@ -145,25 +147,98 @@ BOOST_AUTO_TEST_CASE(NextHopsNoChange)
   fib.update("/ndn/name", oldHops, ndn::nfd::ROUTE_FLAG_CAPTURE);
   face.processEvents(ndn::time::milliseconds(-1));
 
-  // Should register face 1 and 2 for /ndn/name
+  // Faces 1 and 2 are already registered with the same costs
+  BOOST_CHECK_EQUAL(interests.size(), 0);
+  BOOST_CHECK_EQUAL(fib.getRibCommandCounters().nSuppressed, 2);
+}
+
+BOOST_AUTO_TEST_CASE(NextHopsFlagsChange)
+{
+  NexthopList hops;
+  hops.addNextHop(NextHop(router1FaceUri, 10));
+  hops.addNextHop(NextHop(router2FaceUri, 20));
+
+  fib.update("/ndn/name", hops, ndn::nfd::ROUTE_FLAG_CAPTURE);
+  face.processEvents(ndn::time::milliseconds(-1));
+
   BOOST_REQUIRE_EQUAL(interests.size(), 2);
+  interests.clear();
 
-  ndn::nfd::ControlParameters extractedParameters;
-  ndn::Name::Component verb;
-  auto it = interests.begin();
+  fib.update("/ndn/name", hops, ndn::nfd::ROUTE_FLAG_CHILD_INHERIT);
+  face.processEvents(ndn::time::milliseconds(-1));
 
-  extractRibCommandParameters(*it, verb, extractedParameters);
+  // Both faces are registered again, with the new flags
+  BOOST_REQUIRE_EQUAL(interests.size(), 2);
+  for (const auto& interest : interests) {
+    ndn::nfd::ControlParameters extractedParameters;
+    ndn::Name::Component verb;
+    extractRibCommandParameters(interest, verb, extractedParameters);
+    BOOST_CHECK_EQUAL(extractedParameters.getFlags(), ndn::nfd::ROUTE_FLAG_CHILD_INHERIT);
+  }
+  BOOST_CHECK_EQUAL(fib.getRibCommandCounters().nSuppressed, 0);
+}
 
-  BOOST_CHECK(extractedParameters.getName() == "/ndn/name" &&
-              extractedParameters.getFaceId() == router1FaceId &&
-              verb == ndn::Name::Component("register"));
+BOOST_AUTO_TEST_CASE(NextHopsAbandoned)
+{
+  // NFD does not answer on this face, so that the registration is given up eventually
+  ndn::DummyClientFace silentFace(m_io, m_keyChain);
+  ndn::Scheduler scheduler(m_io);
+  Fib silentFib(silentFace, scheduler, adjacencies, conf, m_keyChain);
 
-  ++it;
-  extractRibCommandParameters(*it, verb, extractedParameters);
+  NexthopList hops;
+  hops.addNextHop(NextHop(router1FaceUri, 10));
 
-  BOOST_CHECK(extractedParameters.getName() == "/ndn/name" &&
-              extractedParameters.getFaceId() == router2FaceId &&
-              verb == ndn::Name::Component("register"));
+  silentFib.update("/ndn/name", hops, ndn::nfd::ROUTE_FLAG_CAPTURE);
+  advanceClocks(1_s, 60);
+  BOOST_CHECK_EQUAL(silentFib.getRibCommandCounters().nAbandoned, 1);
+  size_t nSent = silentFace.sentInterests.size();
+
+  // The next update registers the next hop again, although its cost has not changed
+  silentFib.update("/ndn/name", hops, ndn::nfd::ROUTE_FLAG_CAPTURE);
+  advanceClocks(10_ms);
+  BOOST_CHECK_EQUAL(silentFace.sentInterests.size(), nSent + 1);
+  BOOST_CHECK_EQUAL(silentFib.getRibCommandCounters().nSuppressed, 0);
+}
+
+BOOST_AUTO_TEST_CASE(NextHopsCostChange)
+{
+  NextHop hop1(router1FaceUri, 10);
+  NextHop hop2(router2FaceUri, 20);
+
+  NexthopList oldHops;
+  oldHops.addNextHop(hop1);
+  oldHops.addNextHop(hop2);
+
+  fib.update("/ndn/name", oldHops, ndn::nfd::ROUTE_FLAG_CAPTURE);
+  face.processEvents(ndn::time::milliseconds(-1));
+
+  BOOST_REQUIRE_EQUAL(interests.size(), 2);
+  interests.clear();
+
+  NextHop hop2Increased(router2FaceUri, 30);
+
+  NexthopList newHops;
+  newHops.addNextHop(hop1);
+  newHops.addNextHop(hop2Increased);
+
+  fib.update("/ndn/name", newHops, ndn::nfd::ROUTE_FLAG_CAPTURE);
+  face.processEvents(ndn::time::milliseconds(-1));
+
+  // Only face 2 is registered again, with its new cost
+  BOOST_REQUIRE_EQUAL(interests.size(), 1);
+
+  ndn::nfd::ControlParameters extractedParameters;
+  ndn::Name::Component verb;
+  extractRibCommandParameters(interests.front(), verb, extractedParameters);
+
+  BOOST_CHECK_EQUAL(extractedParameters.getName(), ndn::Name("/ndn/name"));
+  BOOST_CHECK_EQUAL(extractedParameters.getFaceId(), router2FaceId);
+  BOOST_CHECK_EQUAL(extractedParameters.getCost(), hop2Increased.getRouteCostAsAdjustedInteger());
+  BOOST_CHECK_EQUAL(verb, ndn::Name::Component("register"));
+
+  const auto& installedHops = fib.m_table.at("/ndn/name").nexthopSet;
+  BOOST_CHECK(std::find(installedHops.begin(), installedHops.end(), hop2Increased) !=
+              installedHops.end());
 }
 
 BOOST_AUTO_TEST_CASE(NextHopsRemoveAll)
@@ -268,13 +343,13 @@ BOOST_AUTO_TEST_CASE(NextHopsMaxPrefixesAfterRecalculation)
   face.processEvents(ndn::time::milliseconds(-1));
 
   // To maintain a max 2 face requirement, face 3 should be registered and face 2 should be
-  // unregistered. Face 1 will also be re-registered.
+  // unregistered. Face 1 is already registered with the same cost.
   //
   // FIB
   // Name         NextHops
   // /ndn/name    (faceId=3, cost=5), (faceId=1, cost=10)
 
-  BOOST_CHECK_EQUAL(interests.size(), 3);
+  BOOST_CHECK_EQUAL(interests.size(), 2);
 
   ndn::nfd::ControlParameters extractedParameters;
   ndn::Name::Component verb;
@@ -282,13 +357,6 @@ BOOST_AUTO_TEST_CASE(NextHopsMaxPrefixesAfterRecalculation)
 
   extractRibCommandParameters(*it, verb, extractedParameters);
 
-  BOOST_CHECK(extractedParameters.getName() == "/ndn/name" &&
-              extractedParameters.getFaceId() == router1FaceId &&
-              verb == ndn::Name::Component("register"));
-
-  ++it;
-  extractRibCommandParameters(*it, verb, extractedParameters);
-
   BOOST_CHECK(extractedParameters.getName() == "/ndn/name" &&
               extractedParameters.getFaceId() == router3FaceId &&
               verb == ndn::Name::Component("register"));
@@ -306,15 +374,63 @@ BOOST_FIXTURE_TEST_CASE(ScheduleFibEntryRefresh, FibFixture)
   ndn::Name name1("/name/1");
   FibEntry fe;
   fe.name = name1;
+  fe.nexthopSet.addNextHop(NextHop(router1FaceUri, 10));
   int origSeqNo = fe.seqNo;
-  fib.m_table.emplace(name1, std::move(fe));
+  FibEntry& entry = fib.m_table.emplace(name1, std::move(fe)).first->second;
+
+  fib.scheduleEntryRefresh(entry, ndn::nfd::ROUTE_FLAG_CAPTURE);
+  BOOST_REQUIRE(entry.refreshTime);
 
-  fib.scheduleEntryRefresh(fe, true,
-                           [&] (auto& entry, bool captureFlag) { BOOST_CHECK_EQUAL(origSeqNo + 1, entry.seqNo); });
-  this->advanceClocks(ndn::time::milliseconds(10), 1);
+  // The first refresh is due in the second half of the one second refresh period
+  this->advanceClocks(ndn::time::milliseconds(10), 49);
+  BOOST_CHECK_EQUAL(entry.seqNo, origSeqNo);
+  BOOST_CHECK_EQUAL(interests.size(), 0);
+
+  this->advanceClocks(ndn::time::milliseconds(10), 51);
+  BOOST_CHECK_EQUAL(entry.seqNo, origSeqNo + 1);
+  BOOST_CHECK_EQUAL(interests.size(), 1);
+}
 
-  // avoid "test case [...] did not check any assertions" message from Boost.Test
-  BOOST_CHECK(true);
+BOOST_AUTO_TEST_CASE(RefreshSpread)
+{
+  const size_t nPrefixes = 100;
+  const int refreshTime = 100;
+  fib.setEntryRefreshTime(refreshTime);
+
+  NextHop hop1(router1FaceUri, 10);
+  NexthopList hops;
+  hops.addNextHop(hop1);
+
+  for (size_t i = 0; i < nPrefixes; ++i) {
+    fib.update(ndn::Name("/prefix").appendNumber(i), hops, ndn::nfd::ROUTE_FLAG_CAPTURE);
+  }
+  advanceClocks(10_ms);
+  BOOST_REQUIRE_EQUAL(interests.size(), nPrefixes);
+  interests.clear();
+
+  // No refresh is due in the first half of the refresh period
+  advanceClocks(1_s, refreshTime / 2 - 1);
+  BOOST_CHECK_EQUAL(interests.size(), 0);
+
+  // Refreshes of the prefixes installed together are spread out, one batch at a time
+  size_t maxPerSecond = 0;
+  for (int i = 0; i < refreshTime / 2 + 10; ++i) {
+    interests.clear();
+    advanceClocks(1_s);
+    maxPerSecond = std::max(maxPerSecond, interests.size());
+    for (const auto& interest : interests) {
+      ndn::nfd::ControlParameters extractedParameters;
+      ndn::Name::Component verb;
+      extractRibCommandParameters(interest, verb, extractedParameters);
+      BOOST_CHECK_EQUAL(verb, ndn::Name::Component("register"));
+    }
+  }
+  // The token bucket admits 4 refreshes per second with a burst of one second worth
+  BOOST_CHECK_LE(maxPerSecond, 8);
+
+  for (const auto& [name, entry] : fib.m_table) {
+    BOOST_CHECK_GE(entry.seqNo, 2);
+  }
 }
 
 BOOST_AUTO_TEST_CASE(ShouldNotRefreshNeighborRoute) // #4799
@@ -386,6 +502,99 @@ BOOST_AUTO_TEST_CASE(PrefixWithdrawalFibUpdateBug) // #5179
   BOOST_CHECK_EQUAL(numRegister, 3);
 }
 
+BOOST_AUTO_TEST_CASE(RibCommandWindow)
+{
+  // NFD does not answer on this face, so that commands stay in flight until they time out
+  ndn::DummyClientFace silentFace(m_io, m_keyChain);
+  ndn::Scheduler scheduler(m_io);
+  Fib silentFib(silentFace, scheduler, adjacencies, conf, m_keyChain);
+  conf.setRibCommandWindow(2);
+
+  NextHop hop1(router1FaceUri, 10);
+  NextHop hop2(router2FaceUri, 20);
+
+  NexthopList hops;
+  hops.addNextHop(hop1);
+  hops.addNextHop(hop2);
+
+  silentFib.update("/ndn/name1", hops, ndn::nfd::ROUTE_FLAG_CAPTURE);
+  silentFib.update("/ndn/name2", hops, ndn::nfd::ROUTE_FLAG_CAPTURE);
+  advanceClocks(10_ms);
+
+  BOOST_CHECK_EQUAL(silentFace.sentInterests.size(), 2);
+  BOOST_CHECK_EQUAL(silentFib.getNInFlightRibCommands(), 2);
+  BOOST_CHECK_EQUAL(silentFib.getRibCommandQueueSize(), 2);
+
+  // Timed out commands leave the window to the queued ones and are retried after a backoff
+  advanceClocks(1_s, 10);
+  BOOST_CHECK_EQUAL(silentFace.sentInterests.size(), 4);
+  BOOST_CHECK_EQUAL(silentFib.getNInFlightRibCommands(), 2);
+  BOOST_CHECK_EQUAL(silentFib.getRibCommandQueueSize(), 0);
+  BOOST_CHECK_EQUAL(silentFib.getRibCommandCounters().nFailed, 2);
+  BOOST_CHECK_EQUAL(silentFib.getRibCommandCounters().nRetried, 2);
+
+  advanceClocks(1_s);
+  BOOST_CHECK_EQUAL(silentFace.sentInterests.size(), 4);
+  BOOST_CHECK_EQUAL(silentFib.getRibCommandQueueSize(), 2);
+  BOOST_CHECK_EQUAL(silentFib.getRibCommandCounters().maxQueueSize, 2);
+}
+
+BOOST_AUTO_TEST_CASE(RibCommandSupersede)
+{
+  // NFD does not answer on this face, so that the window stays full
+  ndn::DummyClientFace silentFace(m_io, m_keyChain);
+  ndn::Scheduler scheduler(m_io);
+  Fib silentFib(silentFace, scheduler, adjacencies, conf, m_keyChain);
+  silentFib.setEntryRefreshTime(1);
+  conf.setRibCommandWindow(1);
+
+  NextHop hop1(router1FaceUri, 10);
+  NextHop hop2(router2FaceUri, 20);
+  NexthopList hops;
+  hops.addNextHop(hop1);
+  hops.addNextHop(hop2);
+  silentFib.update("/ndn/name", hops, ndn::nfd::ROUTE_FLAG_CAPTURE);
+
+  // The refreshes of both next hops are queued behind the registration of face 2
+  advanceClocks(100_ms, 1100_ms);
+  BOOST_CHECK_EQUAL(silentFace.sentInterests.size(), 1);
+  BOOST_CHECK_EQUAL(silentFib.getRibCommandQueueSize(), 3);
+
+  // Face 1 is removed and the cost of face 2 changes while the window is still full
+  NextHop hop2Increased(router2FaceUri, 30);
+  NexthopList newHops;
+  newHops.addNextHop(hop2Increased);
+  silentFib.update("/ndn/name", newHops, ndn::nfd::ROUTE_FLAG_CAPTURE);
+  advanceClocks(1_s, 60);
+
+  // Neither the queued refreshes nor the retries of earlier registrations are sent after the
+  // unregistration of face 1 or the registration of the new cost of face 2
+  bool isFace1Unregistered = false;
+  bool isFace2Updated = false;
+  for (const auto& interest : silentFace.sentInterests) {
+    ndn::nfd::ControlParameters parameters;
+    ndn::Name::Component verb;
+    extractRibCommandParameters(interest, verb, parameters);
+    if (parameters.getFaceId() == router1FaceId) {
+      if (verb == ndn::Name::Component("unregister")) {
+        isFace1Unregistered = true;
+      }
+      else {
+        BOOST_CHECK(!isFace1Unregistered);
+      }
+    }
+    else if (parameters.getCost() == hop2Increased.getRouteCostAsAdjustedInteger()) {
+      isFace2Updated = true;
+    }
+    else {
+      BOOST_CHECK(!isFace2Updated);
+    }
+  }
+  BOOST_CHECK(isFace1Unregistered);
+  BOOST_CHECK(isFace2Updated);
+  BOOST_CHECK_GE(silentFib.getRibCommandCounters().nSuperseded, 2);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace nlsr::tests
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California,
  *                           Arizona Board of Regents.
  *
@@ -36,7 +36,7 @@ public:
   NamePrefixTableFixture()
     : lsdb(face, m_keyChain, conf)
     , fib(face, m_scheduler, conf.getAdjacencyList(), conf, m_keyChain)
-    , rt(m_scheduler, lsdb, conf)
+    , rt(m_io, m_scheduler, lsdb, conf)
     , npt(conf.getRouterPrefix(), fib, rt, rt.afterRoutingChange, lsdb.onLsdbModified)
   {
   }
@@ -260,7 +260,7 @@ BOOST_FIXTURE_TEST_CASE(RoutingTableUpdate, NamePrefixTableFixture)
   rt.addNextHop(destination, hop1);
   rt.addNextHop(destination, hop2);
 
-  npt.updateWithNewRoute(rt.m_rTable);
+  npt.updateWithNewRoute(rt.getRoutingTableEntry());
 
   // At this point the NamePrefixTableEntry should have two NextHops.
   auto nameIterator = std::find_if(npt.begin(), npt.end(),
@@ -276,7 +276,7 @@ BOOST_FIXTURE_TEST_CASE(RoutingTableUpdate, NamePrefixTableFixture)
 
   // Add the other NextHop
   rt.addNextHop(destination, hop3);
-  npt.updateWithNewRoute(rt.m_rTable);
+  npt.updateWithNewRoute(rt.getRoutingTableEntry());
 
   // At this point the NamePrefixTableEntry should have three NextHops.
   nameIterator = std::find_if(npt.begin(), npt.end(),
@@ -290,6 +290,47 @@ BOOST_FIXTURE_TEST_CASE(RoutingTableUpdate, NamePrefixTableFixture)
   BOOST_CHECK_EQUAL(nextHops.size(), 3);
 }
 
+BOOST_FIXTURE_TEST_CASE(RoutingTableUpdateBatched, NamePrefixTableFixture)
+{
+  // A prefix advertised by two routers whose routes both change
+  const ndn::Name router1("/ndn/router1");
+  const ndn::Name router2("/ndn/router2");
+  const ndn::Name prefix("/ndn/prefix");
+  npt.addEntry(prefix, router1, ndn::nfd::ROUTE_FLAG_CHILD_INHERIT);
+  npt.addEntry(prefix, router2, ndn::nfd::ROUTE_FLAG_CHILD_INHERIT);
+
+  NextHop hop1{ndn::FaceUri("udp4://10.0.0.1"), 1};
+  NextHop hop2{ndn::FaceUri("udp4://10.0.0.2"), 2};
+  NextHop hop3{ndn::FaceUri("udp4://10.0.0.3"), 3};
+  NextHop hop4{ndn::FaceUri("udp4://10.0.0.4"), 4};
+  conf.setMaxFacesPerPrefix(0);
+
+  rt.addNextHop(router1, hop1);
+  rt.addNextHop(router2, hop2);
+  npt.updateWithNewRoute(rt.getRoutingTableEntry());
+
+  auto fibEntry = fib.m_table.find(prefix);
+  BOOST_REQUIRE(fibEntry != fib.m_table.end());
+  BOOST_CHECK_EQUAL(fibEntry->second.nexthopSet.size(), 2);
+  int32_t seqNo = fibEntry->second.seqNo;
+
+  rt.addNextHop(router1, hop3);
+  rt.addNextHop(router2, hop4);
+  npt.updateWithNewRoute(rt.getRoutingTableEntry());
+
+  // The FIB entry is updated once for both changes
+  BOOST_CHECK_EQUAL(fibEntry->second.nexthopSet.size(), 4);
+  BOOST_CHECK_EQUAL(fibEntry->second.seqNo, seqNo + 1);
+
+  // Unchanged routes do not update the FIB
+  npt.updateWithNewRoute(rt.getRoutingTableEntry());
+  BOOST_CHECK_EQUAL(fibEntry->second.seqNo, seqNo + 1);
+
+  // Unreachable origins are removed from the FIB
+  npt.updateWithNewRoute({});
+  BOOST_CHECK(fib.m_table.find(prefix) == fib.m_table.end());
+}
+
 BOOST_FIXTURE_TEST_CASE(UpdateFromLsdb, NamePrefixTableFixture)
 {
   auto testTimePoint = time::system_clock::now();
@@ -352,6 +393,82 @@ BOOST_FIXTURE_TEST_CASE(UpdateFromLsdb, NamePrefixTableFixture)
   BOOST_CHECK_EQUAL(npt.m_table.size(), 0);
 }
 
+BOOST_FIXTURE_TEST_CASE(PrefixMovedBetweenShards, NamePrefixTableFixture)
+{
+  auto testTimePoint = time::system_clock::now();
+  const ndn::Name movedName("/moved");
+  const ndn::Name otherName("/other");
+  PrefixInfo moved(movedName, 0);
+
+  for (bool isNewShardFirst : {true, false}) {
+    BOOST_TEST_CONTEXT("isNewShardFirst=" << isNewShardFirst) {
+      ndn::Name router("/router");
+      router.append(isNewShardFirst ? "new-first" : "old-first");
+
+      auto makeShard = [&] (uint32_t shard, uint64_t seqNo, const NamePrefixList& npl) {
+        auto lsa = std::make_shared<NameLsa>(router, seqNo, testTimePoint, npl);
+        lsa->setShard(shard);
+        return lsa;
+      };
+
+      // The prefix is listed by shard 3, then moves to shard 1
+      npt.updateFromLsdb(makeShard(1, 1, NamePrefixList{otherName}),
+                         LsdbUpdate::INSTALLED, {}, {});
+      npt.updateFromLsdb(makeShard(3, 1, NamePrefixList{movedName}),
+                         LsdbUpdate::INSTALLED, {}, {});
+      BOOST_REQUIRE(isNameInNpt(movedName));
+
+      auto newShard = makeShard(1, 2, NamePrefixList{otherName, movedName});
+      auto oldShard = makeShard(3, 2, NamePrefixList());
+      if (isNewShardFirst) {
+        npt.updateFromLsdb(newShard, LsdbUpdate::UPDATED, {moved}, {});
+        npt.updateFromLsdb(oldShard, LsdbUpdate::UPDATED, {}, {moved});
+      }
+      else {
+        npt.updateFromLsdb(oldShard, LsdbUpdate::UPDATED, {}, {moved});
+        npt.updateFromLsdb(newShard, LsdbUpdate::UPDATED, {moved}, {});
+      }
+
+      auto entry = npt.m_table.get<NamePrefixTable::byName>().find(movedName);
+      BOOST_REQUIRE(entry != npt.m_table.get<NamePrefixTable::byName>().end());
+      BOOST_CHECK_EQUAL((*entry)->getRteListSize(), 1);
+
+      // The prefix is withdrawn with the shard that lists it now
+      npt.updateFromLsdb(oldShard, LsdbUpdate::REMOVED, {}, {});
+      BOOST_CHECK(isNameInNpt(movedName));
+      npt.updateFromLsdb(newShard, LsdbUpdate::REMOVED, {}, {});
+      BOOST_CHECK(!isNameInNpt(movedName));
+      BOOST_CHECK(!isNameInNpt(otherName));
+    }
+  }
+}
+
+BOOST_FIXTURE_TEST_CASE(InsertionOrder, NamePrefixTableFixture)
+{
+  const ndn::Name router1("/ndn/router1");
+  const ndn::Name router2("/ndn/router2");
+  std::vector<ndn::Name> names;
+  for (int i = 0; i < 5; ++i) {
+    names.push_back(ndn::Name("/ndn/prefix").appendNumber(i));
+    npt.addEntry(names.back(), router1);
+  }
+  // Adding another origin to an existing prefix does not create another entry
+  npt.addEntry(names[1], router2);
+  npt.removeEntry(names[2], router1);
+  npt.addEntry(names[2], router2);
+
+  std::vector<ndn::Name> expected{names[0], names[1], names[3], names[4], names[2]};
+  std::vector<ndn::Name> actual;
+  for (const auto& entry : npt) {
+    actual.push_back(entry->getNamePrefix());
+  }
+  BOOST_TEST(actual == expected, boost::test_tools::per_element());
+
+  auto entry = npt.m_table.get<NamePrefixTable::byName>().find(names[1]);
+  BOOST_REQUIRE(entry != npt.m_table.get<NamePrefixTable::byName>().end());
+  BOOST_CHECK_EQUAL((*entry)->getRteListSize(), 2);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace nlsr::tests
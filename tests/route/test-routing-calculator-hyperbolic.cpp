@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California,
  *                           Arizona Board of Regents.
  *
@@ -36,6 +36,7 @@ constexpr time::system_clock::time_point MAX_TIME = time::system_clock::time_poi
 static const ndn::Name ROUTER_A_NAME = "/ndn/router/a";
 static const ndn::Name ROUTER_B_NAME = "/ndn/router/b";
 static const ndn::Name ROUTER_C_NAME = "/ndn/router/c";
+static const ndn::Name ROUTER_D_NAME = "/ndn/router/d";
 static const ndn::FaceUri ROUTER_A_FACE("udp4://10.0.0.1:6363");
 static const ndn::FaceUri ROUTER_B_FACE("udp4://10.0.0.2:6363");
 static const ndn::FaceUri ROUTER_C_FACE("udp4://10.0.0.3:6363");
@@ -105,7 +106,8 @@ public:
 
   void runTest(const double& expectedCost)
   {
-    calculateHyperbolicRoutingPath(map, routingTable, lsdb, adjacencies, ROUTER_A_NAME, false);
+    calculateHyperbolicRoutingPath(map, routingTable, *lsdb.getSnapshot(), adjacencies,
+                                   ROUTER_A_NAME, false);
 
     RoutingTableEntry* entryB = routingTable.findRoutingTableEntry(ROUTER_B_NAME);
 
@@ -178,6 +180,23 @@ BOOST_AUTO_TEST_CASE(BasicMultipleAngles)
   runTest(30.655296361);
 }
 
+BOOST_AUTO_TEST_CASE(AngleVectorSizeMismatch)
+{
+  std::vector<double> anglesA = {2.97},
+                      anglesB = {3.0},
+                      anglesC = {2.99};
+  setUpTopology(anglesA, anglesB, anglesC);
+
+  // Router D is not a neighbor, and its distance from B and C cannot be calculated
+  CoordinateLsa coordD(ROUTER_D_NAME, 1, MAX_TIME, 15.0, {2.97, 1.22});
+  lsdb.installLsa(std::make_shared<CoordinateLsa>(coordD));
+  auto lsaRange = lsdb.getLsdbIterator<CoordinateLsa>();
+  map = NameMap::createFromCoordinateLsdb(lsaRange.first, lsaRange.second);
+
+  runTest(20.103356956);
+  BOOST_CHECK(routingTable.findRoutingTableEntry(ROUTER_D_NAME) == nullptr);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace nlsr::tests
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California,
  *                           Arizona Board of Regents.
  *
@@ -31,6 +31,9 @@
 #include "tests/io-key-chain-fixture.hpp"
 #include "tests/test-common.hpp"
 
+#include <algorithm>
+#include <random>
+
 namespace nlsr::tests {
 
 constexpr time::system_clock::time_point MAX_TIME = time::system_clock::time_point::max();
@@ -121,15 +124,138 @@ public:
     lsdb.installLsa(std::make_shared<AdjLsa>(ROUTER_C_NAME, 1, MAX_TIME, adjList));
   }
 
+  /**
+   * @brief Insert Adjacency LSAs of a randomly generated topology into LSDB.
+   * @param nRouters Number of routers, including router A.
+   * @param seed Random seed.
+   *
+   * The routers form a ring with additional random links. Link costs are random.
+   */
+  void
+  setupRandomTopology(size_t nRouters, uint32_t seed)
+  {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> costDist(1.0, 100.0);
+
+    auto& names = randomNames;
+    auto& faces = randomFaces;
+    auto& adjLists = randomAdjLists;
+    names.assign({ROUTER_A_NAME});
+    faces.assign({ROUTER_A_FACE});
+    for (size_t i = 1; i < nRouters; ++i) {
+      names.push_back(ndn::Name("/ndn/site/%C1.Router").append("r" + std::to_string(i)));
+      faces.emplace_back("udp4://10.0.1." + std::to_string(i) + ":6363");
+    }
+
+    adjLists.assign(nRouters, AdjacencyList());
+    randomSeqNos.assign(nRouters, 1);
+    auto addLink = [&] (size_t i, size_t j) {
+      double cost = costDist(rng);
+      adjLists[i].insert(Adjacent(names[j], faces[j], cost, Adjacent::STATUS_ACTIVE, 0, 0));
+      adjLists[j].insert(Adjacent(names[i], faces[i], cost, Adjacent::STATUS_ACTIVE, 0, 0));
+    };
+    for (size_t i = 0; i < nRouters; ++i) {
+      addLink(i, (i + 1) % nRouters);
+    }
+    for (size_t k = 0; k < nRouters; ++k) {
+      size_t i = rng() % nRouters;
+      size_t j = rng() % nRouters;
+      if (i != j) {
+        addLink(i, j);
+      }
+    }
+
+    for (const auto& adjacent : adjLists[0]) {
+      conf.getAdjacencyList().insert(adjacent);
+    }
+    for (size_t i = 0; i < nRouters; ++i) {
+      lsdb.installLsa(std::make_shared<AdjLsa>(names[i], 1, MAX_TIME, adjLists[i]));
+    }
+  }
+
+  /**
+   * @brief Change a link of the random topology and reissue Adjacency LSAs of both ends.
+   * @param cost New link cost, or NAN to remove the link.
+   */
+  void
+  setRandomLinkCost(size_t i, size_t j, double cost)
+  {
+    for (auto [from, to] : {std::pair(i, j), std::pair(j, i)}) {
+      AdjacencyList& adjList = randomAdjLists[from];
+      auto it = adjList.findAdjacent(randomNames[to]);
+      if (it != adjList.end()) {
+        adjList.erase(it);
+      }
+      if (!std::isnan(cost)) {
+        adjList.insert(Adjacent(randomNames[to], randomFaces[to], cost,
+                                Adjacent::STATUS_ACTIVE, 0, 0));
+      }
+      lsdb.installLsa(std::make_shared<AdjLsa>(randomNames[from], ++randomSeqNos[from],
+                                               MAX_TIME, adjList));
+    }
+  }
+
+  /**
+   * @brief Verify that the routing table has the same entries in the same order.
+   */
+  void
+  checkSameRoutingTable(const std::list<RoutingTableEntry>& expected) const
+  {
+    BOOST_REQUIRE_EQUAL(routingTable.getRoutingTableEntry().size(), expected.size());
+
+    auto actual = routingTable.getRoutingTableEntry().begin();
+    for (const auto& entry : expected) {
+      BOOST_CHECK_EQUAL(actual->getDestination(), entry.getDestination());
+      BOOST_CHECK(actual->getNexthopList() == entry.getNexthopList());
+      ++actual;
+    }
+  }
+
+  /**
+   * @brief Verify that the routing table is the same as the result of a full calculation.
+   */
+  void
+  checkSameAsFullCalculation()
+  {
+    auto actual = routingTable.getRoutingTableEntry();
+    routingTable.clearRoutingTable();
+    calculatePath();
+
+    BOOST_REQUIRE_EQUAL(actual.size(), routingTable.getRoutingTableEntry().size());
+    for (const auto& entry : actual) {
+      BOOST_TEST_CONTEXT("Destination " << entry.getDestination()) {
+        auto expected = routingTable.findRoutingTableEntry(entry.getDestination());
+        BOOST_REQUIRE(expected != nullptr);
+        BOOST_CHECK(entry.getNexthopList() == expected->getNexthopList());
+      }
+    }
+    routingTable.clearRoutingTable();
+  }
+
   /**
    * @brief Run link-state routing calculator.
    */
   void
-  calculatePath()
+  calculatePath(SpfThreadPool* threadPool = nullptr)
   {
     auto lsaRange = lsdb.getLsdbIterator<AdjLsa>();
     NameMap map = NameMap::createFromAdjLsdb(lsaRange.first, lsaRange.second);
-    calculateLinkStateRoutingPath(map, routingTable, conf, lsdb);
+    calculateLinkStateRoutingPath(map, routingTable, conf, conf.getAdjacencyList(),
+                                  *lsdb.getSnapshot(), threadPool);
+  }
+
+  /**
+   * @brief Run incremental link-state routing calculator on Adjacency LSAs changed since its
+   *        previous run.
+   */
+  void
+  calculateIncremental(SpfThreadPool* threadPool = nullptr)
+  {
+    routingTable.m_incrementalCalculator.calculatePath(routingTable, conf, conf.getAdjacencyList(),
+                                                       *lsdb.getSnapshot(),
+                                                       routingTable.m_changedAdjLsaRouters,
+                                                       threadPool);
+    routingTable.m_changedAdjLsaRouters.clear();
   }
 
   /**
@@ -165,6 +291,11 @@ public:
 
   RoutingTable& routingTable;
   Lsdb& lsdb;
+
+  std::vector<ndn::Name> randomNames;
+  std::vector<ndn::FaceUri> randomFaces;
+  std::vector<AdjacencyList> randomAdjLists;
+  std::vector<uint64_t> randomSeqNos;
 };
 
 BOOST_FIXTURE_TEST_SUITE(TestRoutingCalculatorLinkState, LinkStateCalculatorFixture)
@@ -292,6 +423,127 @@ BOOST_AUTO_TEST_CASE(OnePath)
   });
 }
 
+BOOST_AUTO_TEST_CASE(LinearAndHeapAgree)
+{
+  setupRandomTopology(50, 1);
+
+  for (uint32_t maxFacesPerPrefix : {1, 0}) {
+    BOOST_TEST_CONTEXT("max-faces-per-prefix " << maxFacesPerPrefix) {
+      conf.setMaxFacesPerPrefix(maxFacesPerPrefix);
+
+      conf.setSpfAlgorithm(SpfAlgorithm::LINEAR);
+      calculatePath();
+      auto expected = routingTable.getRoutingTableEntry();
+      routingTable.clearRoutingTable();
+
+      conf.setSpfAlgorithm(SpfAlgorithm::HEAP);
+      calculatePath();
+      checkSameRoutingTable(expected);
+      routingTable.clearRoutingTable();
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ParallelMultiPath)
+{
+  setupRandomTopology(50, 4);
+  conf.setMaxFacesPerPrefix(0);
+
+  calculatePath();
+  auto expected = routingTable.getRoutingTableEntry();
+  routingTable.clearRoutingTable();
+
+  // The same threads are reused by each calculation
+  SpfThreadPool threadPool(4);
+  for (int i = 0; i < 3; ++i) {
+    calculatePath(&threadPool);
+    checkSameRoutingTable(expected);
+    routingTable.clearRoutingTable();
+  }
+
+  calculateIncremental(&threadPool);
+  checkSameAsFullCalculation();
+}
+
+BOOST_AUTO_TEST_CASE(ThreadPoolException)
+{
+  SpfThreadPool threadPool(4);
+  BOOST_CHECK_THROW(threadPool.forEachIndex(1000, [] (size_t i) {
+                      if (i == 10) {
+                        throw std::runtime_error("failure");
+                      }
+                    }),
+                    std::runtime_error);
+
+  // The pool can still be used
+  std::vector<int> invoked(100, 0);
+  threadPool.forEachIndex(invoked.size(), [&] (size_t i) { ++invoked[i]; });
+  BOOST_CHECK(std::all_of(invoked.begin(), invoked.end(), [] (int n) { return n == 1; }));
+}
+
+BOOST_AUTO_TEST_CASE(Incremental)
+{
+  conf.setIncrementalSpf(true);
+  setupRandomTopology(50, 2);
+  size_t nRouters = randomNames.size();
+  auto& calculator = routingTable.m_incrementalCalculator;
+
+  std::mt19937 rng(3);
+  std::uniform_real_distribution<double> costDist(1.0, 100.0);
+  auto pickNeighbor = [&] (size_t i) {
+    std::vector<size_t> neighbors;
+    for (size_t j = 0; j < nRouters; ++j) {
+      if (randomAdjLists[i].isNeighbor(randomNames[j])) {
+        neighbors.push_back(j);
+      }
+    }
+    return neighbors.at(rng() % neighbors.size());
+  };
+
+  for (uint32_t maxFacesPerPrefix : {1, 0}) {
+    BOOST_TEST_CONTEXT("max-faces-per-prefix " << maxFacesPerPrefix) {
+      conf.setMaxFacesPerPrefix(maxFacesPerPrefix);
+      calculator.reset();
+      uint64_t nFull = calculator.getNFullCalculations();
+      uint64_t nIncremental = calculator.getNIncrementalCalculations();
+
+      calculateIncremental();
+      BOOST_CHECK_EQUAL(calculator.getNFullCalculations(), nFull + 1);
+      checkSameAsFullCalculation();
+
+      std::optional<std::pair<size_t, size_t>> removedLink;
+      for (int round = 0; round < 10; ++round) {
+        BOOST_TEST_CONTEXT("round " << round) {
+          // Every other round changes a link of router A itself.
+          size_t i = round % 2 == 0 ? 0 : rng() % nRouters;
+          setRandomLinkCost(i, pickNeighbor(i), costDist(rng));
+          i = rng() % nRouters;
+          setRandomLinkCost(i, pickNeighbor(i), costDist(rng));
+
+          if (removedLink) {
+            setRandomLinkCost(removedLink->first, removedLink->second, costDist(rng));
+          }
+          i = round % 3 == 0 ? 0 : rng() % nRouters;
+          removedLink.emplace(i, pickNeighbor(i));
+          setRandomLinkCost(removedLink->first, removedLink->second, NAN);
+
+          calculateIncremental();
+          BOOST_CHECK_EQUAL(calculator.getNIncrementalCalculations(), nIncremental + round + 1);
+          checkSameAsFullCalculation();
+        }
+      }
+
+      // Changing most links at once leads to a full calculation.
+      for (size_t i = 0; i < nRouters; ++i) {
+        setRandomLinkCost(i, (i + 1) % nRouters, costDist(rng));
+      }
+      calculateIncremental();
+      BOOST_CHECK_EQUAL(calculator.getNFullCalculations(), nFull + 2);
+      checkSameAsFullCalculation();
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(SourceRouterAbsent)
 {
   // RouterA does not exist in the LSDB.
@@ -308,7 +560,7 @@ BOOST_AUTO_TEST_CASE(SourceRouterAbsent)
   calculatePath();
 
   // There should be no routes.
-  BOOST_CHECK(routingTable.m_rTable.empty());
+  BOOST_CHECK(routingTable.getRoutingTableEntry().empty());
 }
 
 BOOST_AUTO_TEST_SUITE_END()
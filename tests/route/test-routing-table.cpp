@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California
  *
  * This file is part of NLSR (Named-data Link State Routing).
@@ -26,6 +26,11 @@
 #include "tests/io-key-chain-fixture.hpp"
 #include "tests/test-common.hpp"
 
+#include <boost/asio/post.hpp>
+
+#include <future>
+#include <thread>
+
 namespace nlsr::tests {
 
 class RoutingTableFixture : public IoKeyChainFixture
@@ -39,7 +44,7 @@ public:
   DummyConfFileProcessor confProcessor{conf};
 
   Lsdb lsdb{face, m_keyChain, conf};
-  RoutingTable rt{m_scheduler, lsdb, conf};
+  RoutingTable rt{m_io, m_scheduler, lsdb, conf};
 };
 
 BOOST_AUTO_TEST_SUITE(TestRoutingTable)
@@ -53,6 +58,35 @@ BOOST_FIXTURE_TEST_CASE(AddNextHop, RoutingTableFixture)
   BOOST_CHECK_EQUAL(rt.findRoutingTableEntry(DEST_ROUTER)->getDestination(), DEST_ROUTER);
 }
 
+BOOST_FIXTURE_TEST_CASE(FindRoutingTableEntry, RoutingTableFixture)
+{
+  NextHop nh1(ndn::FaceUri("udp4://10.0.0.1:6363"), 1);
+  NextHop nh2(ndn::FaceUri("udp4://10.0.0.2:6363"), 2);
+  for (int i = 0; i < 100; ++i) {
+    rt.addNextHop(ndn::Name("/router").appendNumber(i), nh1);
+  }
+  rt.addNextHop(ndn::Name("/router").appendNumber(50), nh2);
+  BOOST_CHECK_EQUAL(rt.getRoutingTableEntry().size(), 100);
+  BOOST_CHECK_EQUAL(rt.getRoutingTableEntry().front().getDestination(),
+                    ndn::Name("/router").appendNumber(0));
+
+  auto entry = rt.findRoutingTableEntry(ndn::Name("/router").appendNumber(50));
+  BOOST_REQUIRE(entry != nullptr);
+  BOOST_CHECK_EQUAL(entry->getNexthopList().size(), 2);
+  BOOST_CHECK(rt.findRoutingTableEntry("/router/unknown") == nullptr);
+
+  // A copy looks up its own entries
+  RoutingTableStatus copy(rt);
+  auto copiedEntry = copy.findRoutingTableEntry(ndn::Name("/router").appendNumber(50));
+  BOOST_REQUIRE(copiedEntry != nullptr);
+  BOOST_CHECK_NE(copiedEntry, entry);
+  BOOST_CHECK_EQUAL(copiedEntry->getNexthopList().size(), 2);
+
+  rt.clearRoutingTable();
+  BOOST_CHECK(rt.findRoutingTableEntry(ndn::Name("/router").appendNumber(50)) == nullptr);
+  BOOST_CHECK(copy.findRoutingTableEntry(ndn::Name("/router").appendNumber(50)) != nullptr);
+}
+
 const uint8_t RoutingTableData1[] = {
   // Header
   0x90, 0x30,
@@ -92,7 +126,7 @@ BOOST_FIXTURE_TEST_CASE(Decode, RoutingTableFixture)
 {
   RoutingTableStatus rtStatus(ndn::Block{RoutingTableData1});
 
-  auto it1 = rtStatus.m_rTable.begin();
+  auto it1 = rtStatus.getRoutingTableEntry().begin();
   ndn::Name des1 = it1->getDestination();
   BOOST_CHECK_EQUAL(des1, "dest1");
 
@@ -100,7 +134,7 @@ BOOST_FIXTURE_TEST_CASE(Decode, RoutingTableFixture)
   BOOST_CHECK_EQUAL(it2->getConnectingFaceUri(), ndn::FaceUri("udp4://192.168.3.1:6363"));
   BOOST_CHECK_EQUAL(it2->getRouteCost(), 1.65);
 
-  BOOST_CHECK_EQUAL(rtStatus.m_rTable.size(), 1);
+  BOOST_CHECK_EQUAL(rtStatus.getRoutingTableEntry().size(), 1);
 }
 
 BOOST_FIXTURE_TEST_CASE(OutputStream, RoutingTableFixture)
@@ -154,9 +188,9 @@ BOOST_FIXTURE_TEST_CASE(UpdateFromLsdb, RoutingTableFixture)
   adj.setStatus(Adjacent::STATUS_ACTIVE);
   conf.getAdjacencyList().insert(adj);
   lsdb.scheduleAdjLsaBuild();
-  BOOST_CHECK_EQUAL(rt.m_rTable.size(), 0);
+  BOOST_CHECK_EQUAL(rt.getRoutingTableEntry().size(), 0);
   advanceClocks(15_s);
-  BOOST_CHECK_EQUAL(rt.m_rTable.size(), 1);
+  BOOST_CHECK_EQUAL(rt.getRoutingTableEntry().size(), 1);
 
   rt.wireEncode();
   BOOST_CHECK(rt.m_wire.isValid());
@@ -167,7 +201,7 @@ BOOST_FIXTURE_TEST_CASE(UpdateFromLsdb, RoutingTableFixture)
   conf.getAdjacencyList().setTimedOutInterestCount("/router4", HELLO_RETRIES_MAX);
   lsdb.scheduleAdjLsaBuild();
   advanceClocks(15_s);
-  BOOST_CHECK_EQUAL(rt.m_rTable.size(), 0);
+  BOOST_CHECK_EQUAL(rt.getRoutingTableEntry().size(), 0);
   BOOST_CHECK(!rt.m_wire.isValid());
 
   // Check that HR routing is scheduled, once Coordinate LSA is added
@@ -192,10 +226,119 @@ BOOST_FIXTURE_TEST_CASE(UpdateFromLsdb, RoutingTableFixture)
   conf.getAdjacencyList().setStatusOfNeighbor("/router5", Adjacent::STATUS_INACTIVE);
   rt.scheduleRoutingTableCalculation();
   advanceClocks(15_s);
-  BOOST_CHECK_EQUAL(rt.m_rTable.size(), 0);
+  BOOST_CHECK_EQUAL(rt.getRoutingTableEntry().size(), 0);
   BOOST_CHECK(!rt.m_wire.isValid());
 }
 
+BOOST_FIXTURE_TEST_CASE(CalculateInBackground, RoutingTableFixture)
+{
+  conf.setRoutingCalcInBackground(true);
+  auto testTimePoint = time::system_clock::now() + 3600_s;
+
+  AdjacencyList adjl;
+  Adjacent ownAdj(conf.getRouterPrefix());
+  ownAdj.setStatus(Adjacent::STATUS_ACTIVE);
+  adjl.insert(ownAdj);
+  lsdb.installLsa(std::make_shared<AdjLsa>("/router4", 12, testTimePoint, adjl));
+
+  Adjacent adj("/router4");
+  adj.setStatus(Adjacent::STATUS_ACTIVE);
+  conf.getAdjacencyList().insert(adj);
+  lsdb.scheduleAdjLsaBuild();
+  advanceClocks(15_s);
+
+  // The result is installed on the I/O thread after the worker thread completes
+  for (int i = 0; i < 5000 && rt.m_isRoutingTableCalculating; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    advanceClocks(1_ms);
+  }
+  BOOST_CHECK(!rt.m_isRoutingTableCalculating);
+  BOOST_REQUIRE_EQUAL(rt.getRoutingTableEntry().size(), 1);
+  BOOST_CHECK_EQUAL(rt.getRoutingTableEntry().front().getDestination(), "/router4");
+}
+
+BOOST_FIXTURE_TEST_CASE(ScheduledDuringBackgroundCalculation, RoutingTableFixture)
+{
+  conf.setRoutingCalcInBackground(true);
+  rt.m_hyperbolicState = HYPERBOLIC_STATE_ON;
+
+  // Keep the worker thread busy, so that the calculation stays in progress
+  std::promise<void> release;
+  rt.m_calculationThread = std::make_unique<boost::asio::thread_pool>(1);
+  boost::asio::post(*rt.m_calculationThread,
+                    [isReleased = release.get_future().share()] { isReleased.wait(); });
+
+  auto waitForCalculations = [&] (uint64_t nCalculations) {
+    for (int i = 0; i < 5000 && (rt.m_isRoutingTableCalculating ||
+                                 rt.getNCalculations() < nCalculations); ++i) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      advanceClocks(1_ms);
+    }
+  };
+
+  rt.calculate();
+  BOOST_CHECK(rt.m_isRoutingTableCalculating);
+  BOOST_CHECK_EQUAL(rt.getNCalculations(), 1);
+
+  // The scheduled calculation fires while the first one is still in progress
+  rt.scheduleRoutingTableCalculation();
+  advanceClocks(1_s, 20_s);
+  BOOST_CHECK(rt.m_isRoutingTableCalculating);
+  BOOST_CHECK(!rt.m_isRouteCalculationScheduled);
+  BOOST_CHECK(rt.m_isCalculationPending);
+  BOOST_CHECK_EQUAL(rt.getNCalculations(), 1);
+
+  // It starts when the first one completes
+  release.set_value();
+  waitForCalculations(2);
+  BOOST_CHECK(!rt.m_isRoutingTableCalculating);
+  BOOST_CHECK(!rt.m_isCalculationPending);
+  BOOST_CHECK_EQUAL(rt.getNCalculations(), 2);
+
+  // Later changes are not suppressed
+  rt.scheduleRoutingTableCalculation();
+  BOOST_CHECK(rt.m_isRouteCalculationScheduled);
+  advanceClocks(1_s, 20_s);
+  waitForCalculations(3);
+  BOOST_CHECK_EQUAL(rt.getNCalculations(), 3);
+  BOOST_CHECK_EQUAL(rt.getNSuppressedCalculations(), 0);
+}
+
+BOOST_FIXTURE_TEST_CASE(SpfThrottle, RoutingTableFixture)
+{
+  conf.setSpfThrottle(true);
+  conf.setSpfInitialWait(50);
+  conf.setSpfBackoffWait(200);
+  conf.setSpfMaxWait(500);
+  rt.m_hyperbolicState = HYPERBOLIC_STATE_ON;
+
+  // The first calculation waits the initial wait; a second request is merged into it
+  rt.scheduleRoutingTableCalculation();
+  rt.scheduleRoutingTableCalculation();
+  advanceClocks(10_ms, 40_ms);
+  BOOST_CHECK_EQUAL(rt.getNCalculations(), 0);
+  advanceClocks(10_ms, 20_ms);
+  BOOST_CHECK_EQUAL(rt.getNCalculations(), 1);
+  BOOST_CHECK_EQUAL(rt.getNSuppressedCalculations(), 1);
+
+  // Further calculations back off exponentially up to the max wait
+  for (auto wait : {200_ms, 400_ms, 500_ms, 500_ms}) {
+    rt.scheduleRoutingTableCalculation();
+    advanceClocks(wait - 10_ms);
+    BOOST_CHECK(rt.m_isRouteCalculationScheduled);
+    advanceClocks(20_ms);
+    BOOST_CHECK(!rt.m_isRouteCalculationScheduled);
+  }
+  BOOST_CHECK_EQUAL(rt.getNCalculations(), 5);
+
+  // After a quiet period, the initial wait applies again
+  advanceClocks(1_s);
+  rt.scheduleRoutingTableCalculation();
+  advanceClocks(10_ms, 60_ms);
+  BOOST_CHECK(!rt.m_isRouteCalculationScheduled);
+  BOOST_CHECK_EQUAL(rt.getNCalculations(), 6);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace nlsr::tests
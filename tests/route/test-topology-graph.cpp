@@ -0,0 +1,113 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "route/topology-graph.hpp"
+
+#include "adjacent.hpp"
+
+#include "tests/boost-test.hpp"
+
+namespace nlsr::tests {
+
+BOOST_AUTO_TEST_SUITE(TestTopologyGraph)
+
+BOOST_AUTO_TEST_CASE(Basic)
+{
+  TopologyGraph graph(3, {
+    {0, 2, 10.0},
+    {0, 1, 5.0},
+    {1, 0, 5.0},
+    {2, 0, 10.0},
+  });
+
+  BOOST_CHECK_EQUAL(graph.size(), 3);
+  BOOST_CHECK_EQUAL(graph.getNLinks(), 2);
+
+  auto links = graph.getLinks(0);
+  BOOST_REQUIRE_EQUAL(links.size(), 2);
+  BOOST_CHECK_EQUAL(links[0].neighbor, 1);
+  BOOST_CHECK_EQUAL(links[0].cost, 5.0);
+  BOOST_CHECK_EQUAL(links[1].neighbor, 2);
+  BOOST_CHECK_EQUAL(links[1].cost, 10.0);
+
+  BOOST_CHECK_EQUAL(graph.getLinks(1).size(), 1);
+  BOOST_CHECK_EQUAL(graph.getLinks(2).size(), 1);
+  BOOST_CHECK_EQUAL(graph.getLinkCost(2, 0), 10.0);
+  BOOST_CHECK_EQUAL(graph.getLinkCost(1, 2), Adjacent::NON_ADJACENT_COST);
+}
+
+BOOST_AUTO_TEST_CASE(CostCorrection)
+{
+  TopologyGraph graph(4, {
+    // asymmetric cost: higher cost is used for both directions
+    {0, 1, 5.0},
+    {1, 0, 7.0},
+    // broken on one side: link is omitted
+    {1, 2, 3.0},
+    {2, 1, Adjacent::NON_ADJACENT_COST},
+    // advertised by one side only: link is omitted
+    {2, 3, 4.0},
+    // self link: ignored
+    {3, 3, 1.0},
+  });
+
+  BOOST_CHECK_EQUAL(graph.getNLinks(), 1);
+  BOOST_CHECK_EQUAL(graph.getLinkCost(0, 1), 7.0);
+  BOOST_CHECK_EQUAL(graph.getLinkCost(1, 0), 7.0);
+  BOOST_CHECK_EQUAL(graph.getLinkCost(1, 2), Adjacent::NON_ADJACENT_COST);
+  BOOST_CHECK_EQUAL(graph.getLinkCost(2, 1), Adjacent::NON_ADJACENT_COST);
+  BOOST_CHECK_EQUAL(graph.getLinkCost(2, 3), Adjacent::NON_ADJACENT_COST);
+  BOOST_CHECK_EQUAL(graph.getLinks(3).size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(CreateFromAdjLsdb)
+{
+  ndn::Name nameA("/ndn/site/%C1.Router/a");
+  ndn::Name nameB("/ndn/site/%C1.Router/b");
+  ndn::Name nameC("/ndn/site/%C1.Router/c");
+  auto expiration = ndn::time::system_clock::time_point::max();
+
+  AdjacencyList adjListA;
+  adjListA.insert(Adjacent(nameB, ndn::FaceUri("udp4://10.0.0.2"), 5, Adjacent::STATUS_ACTIVE, 0, 0));
+  adjListA.insert(Adjacent(nameC, ndn::FaceUri("udp4://10.0.0.3"), 10, Adjacent::STATUS_ACTIVE, 0, 0));
+  AdjacencyList adjListB;
+  adjListB.insert(Adjacent(nameA, ndn::FaceUri("udp4://10.0.0.1"), 5, Adjacent::STATUS_ACTIVE, 0, 0));
+
+  std::vector<std::shared_ptr<Lsa>> lsas{
+    std::make_shared<AdjLsa>(nameA, 1, expiration, adjListA),
+    std::make_shared<AdjLsa>(nameB, 1, expiration, adjListB),
+  };
+  auto map = NameMap::createFromAdjLsdb(lsas.begin(), lsas.end());
+  auto graph = TopologyGraph::createFromAdjLsdb(lsas.begin(), lsas.end(), map);
+
+  // C has no Adjacency LSA, so the link between A and C is not bidirectional
+  BOOST_CHECK_EQUAL(graph.size(), 3);
+  BOOST_CHECK_EQUAL(graph.getNLinks(), 1);
+  BOOST_CHECK_EQUAL(graph.getLinkCost(*map.getMappingNoByRouterName(nameA),
+                                      *map.getMappingNoByRouterName(nameB)), 5);
+  BOOST_CHECK_EQUAL(graph.getLinkCost(*map.getMappingNoByRouterName(nameA),
+                                      *map.getMappingNoByRouterName(nameC)),
+                    Adjacent::NON_ADJACENT_COST);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace nlsr::tests
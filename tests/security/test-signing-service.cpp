@@ -0,0 +1,187 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "security/signing-service.hpp"
+
+#include "tests/boost-test.hpp"
+#include "tests/io-key-chain-fixture.hpp"
+
+#include <ndn-cxx/encoding/block-helpers.hpp>
+#include <ndn-cxx/security/signing-helpers.hpp>
+#include <ndn-cxx/security/verification-helpers.hpp>
+
+#include <filesystem>
+#include <thread>
+
+namespace nlsr::tests {
+
+using security::SigningService;
+
+class SigningServiceFixture : public IoKeyChainFixture
+{
+public:
+  SigningServiceFixture()
+    : keyChainDir(std::filesystem::temp_directory_path() / "nlsr-test-signing-service")
+  {
+    std::filesystem::remove_all(keyChainDir);
+    std::filesystem::create_directories(keyChainDir);
+    sqliteKeyChain = std::make_unique<ndn::KeyChain>("pib-sqlite3:" + keyChainDir.string(),
+                                                     "tpm-file:" + keyChainDir.string());
+    identity = sqliteKeyChain->createIdentity("/signing-service");
+  }
+
+  ~SigningServiceFixture()
+  {
+    sqliteKeyChain.reset();
+    std::error_code ec;
+    std::filesystem::remove_all(keyChainDir, ec); // ignore error
+  }
+
+  /*! \brief Processes the results posted by the worker threads until \p isDone returns true.
+   */
+  template<typename Predicate>
+  void
+  waitFor(const Predicate& isDone)
+  {
+    for (int i = 0; i < 5000 && !isDone(); ++i) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      advanceClocks(1_ms);
+    }
+  }
+
+public:
+  const std::filesystem::path keyChainDir;
+  std::unique_ptr<ndn::KeyChain> sqliteKeyChain;
+  ndn::security::Identity identity;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestSigningService, SigningServiceFixture)
+
+BOOST_AUTO_TEST_CASE(InMemoryKeyChain)
+{
+  // An in-memory KeyChain cannot be shared with worker threads
+  SigningService service(m_io, m_keyChain, 2);
+  BOOST_CHECK(!service.isInBackground());
+
+  bool isSigned = false;
+  service.sign(std::make_shared<ndn::Data>("/data"), ndn::security::SigningInfo(),
+               [&] (const auto& data) {
+                 BOOST_CHECK(data->hasWire());
+                 isSigned = true;
+               });
+  BOOST_CHECK(isSigned);
+  BOOST_CHECK_EQUAL(service.getNPending(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Sign)
+{
+  SigningService service(m_io, *sqliteKeyChain, 2);
+  BOOST_REQUIRE(service.isInBackground());
+
+  std::vector<std::shared_ptr<ndn::Data>> signedData;
+  for (int i = 0; i < 10; ++i) {
+    service.sign(std::make_shared<ndn::Data>(ndn::Name("/data").appendNumber(i)),
+                 ndn::security::signingByIdentity(identity),
+                 [&] (const auto& data) { signedData.push_back(data); });
+  }
+  // Callbacks are only invoked on the I/O thread
+  BOOST_CHECK(signedData.empty());
+  BOOST_CHECK_EQUAL(service.getNPending(), 10);
+
+  waitFor([&] { return signedData.size() == 10; });
+  BOOST_REQUIRE_EQUAL(signedData.size(), 10);
+  BOOST_CHECK_EQUAL(service.getNPending(), 0);
+  for (const auto& data : signedData) {
+    BOOST_CHECK(ndn::security::verifySignature(*data, identity.getDefaultKey()));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Segment)
+{
+  SigningService service(m_io, *sqliteKeyChain, 1);
+
+  std::vector<uint8_t> payload(5000, 0xBB);
+  ndn::Block block = ndn::makeBinaryBlock(128, payload);
+
+  std::vector<std::shared_ptr<ndn::Data>> segments;
+  service.segment(block, ndn::Name("/lsa").appendVersion(1), 1000, 10_s,
+                  ndn::security::signingByIdentity(identity),
+                  [&] (auto result) { segments = std::move(result); });
+
+  waitFor([&] { return !segments.empty(); });
+  BOOST_REQUIRE_GT(segments.size(), 1);
+  for (size_t i = 0; i < segments.size(); ++i) {
+    BOOST_CHECK_EQUAL(segments[i]->getName(),
+                      ndn::Name("/lsa").appendVersion(1).appendSegment(i));
+    BOOST_CHECK(ndn::security::verifySignature(*segments[i], identity.getDefaultKey()));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(UrgentDoesNotWait)
+{
+  SigningService service(m_io, *sqliteKeyChain, 1);
+
+  std::vector<uint8_t> payload(100000, 0xBB);
+  ndn::Block block = ndn::makeBinaryBlock(128, payload);
+
+  // Each job signs about 100 segments on the only normal thread
+  size_t nSegmented = 0;
+  for (int i = 0; i < 4; ++i) {
+    service.segment(block, ndn::Name("/lsa").appendVersion(i), 1000, 10_s,
+                    ndn::security::signingByIdentity(identity),
+                    [&] (const auto&) { ++nSegmented; });
+  }
+
+  std::shared_ptr<ndn::Data> reply;
+  service.sign(std::make_shared<ndn::Data>("/hello"), ndn::security::signingByIdentity(identity),
+               [&] (const auto& data) { reply = data; },
+               SigningService::Priority::URGENT);
+
+  waitFor([&] { return reply != nullptr; });
+  BOOST_REQUIRE(reply != nullptr);
+  BOOST_CHECK(ndn::security::verifySignature(*reply, identity.getDefaultKey()));
+  // The reply did not wait for the segmentation jobs queued before it
+  BOOST_CHECK_LT(nSegmented, 4);
+
+  waitFor([&] { return nSegmented == 4; });
+  BOOST_CHECK_EQUAL(nSegmented, 4);
+  BOOST_CHECK_EQUAL(service.getNPending(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(DestroyWhilePending)
+{
+  bool isInvoked = false;
+  {
+    SigningService service(m_io, *sqliteKeyChain, 1);
+    for (int i = 0; i < 5; ++i) {
+      service.sign(std::make_shared<ndn::Data>("/data"),
+                   ndn::security::signingByIdentity(identity),
+                   [&] (const auto&) { isInvoked = true; });
+    }
+  }
+  // Results of a destroyed service are discarded
+  advanceClocks(1_ms, 10);
+  BOOST_CHECK(!isInvoked);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace nlsr::tests
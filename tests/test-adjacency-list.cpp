@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California,
  *                           Arizona Board of Regents.
  *
@@ -74,6 +74,47 @@ BOOST_AUTO_TEST_CASE(FindAdjacentByFaceUri)
   BOOST_CHECK(adjIter != adjList.end());
 }
 
+BOOST_AUTO_TEST_CASE(FindAdjacentByFaceId)
+{
+  AdjacencyList adjList;
+  for (int i = 1; i <= 3; ++i) {
+    adjList.insert(Adjacent(ndn::Name("/ndn/test").appendNumber(i),
+                            ndn::FaceUri("udp4://10.0.0." + std::to_string(i) + ":6363"),
+                            10, Adjacent::STATUS_ACTIVE, 0, 100 + i));
+  }
+  BOOST_CHECK_EQUAL(adjList.findAdjacent(102)->getName(), ndn::Name("/ndn/test").appendNumber(2));
+  BOOST_CHECK(adjList.findAdjacent(200) == adjList.end());
+
+  // FaceIds changed through an iterator are found under their new value only
+  adjList.findAdjacent(102)->setFaceId(202);
+  BOOST_CHECK(adjList.findAdjacent(102) == adjList.end());
+  BOOST_CHECK_EQUAL(adjList.findAdjacent(202)->getName(), ndn::Name("/ndn/test").appendNumber(2));
+  BOOST_CHECK_EQUAL(adjList.getFaceId(ndn::FaceUri("udp4://10.0.0.2:6363")), 202);
+}
+
+BOOST_AUTO_TEST_CASE(InsertAndErase)
+{
+  AdjacencyList adjList;
+  for (int i = 1; i <= 3; ++i) {
+    ndn::FaceUri faceUri("udp4://10.0.0." + std::to_string(i) + ":6363");
+    BOOST_CHECK(adjList.insert(Adjacent(ndn::Name("/ndn/test").appendNumber(i), faceUri,
+                                        10, Adjacent::STATUS_ACTIVE, 0, 100 + i)));
+  }
+  BOOST_CHECK(!adjList.insert(Adjacent(ndn::Name("/ndn/test").appendNumber(1))));
+  BOOST_CHECK_EQUAL(adjList.size(), 3);
+
+  adjList.erase(adjList.findAdjacent(ndn::Name("/ndn/test").appendNumber(1)));
+  BOOST_CHECK_EQUAL(adjList.size(), 2);
+  BOOST_CHECK(!adjList.isNeighbor(ndn::Name("/ndn/test").appendNumber(1)));
+  BOOST_CHECK(adjList.findAdjacent(101) == adjList.end());
+
+  // The adjacencies after the erased one are still found, in insertion order
+  BOOST_CHECK_EQUAL(adjList.begin()->getName(), ndn::Name("/ndn/test").appendNumber(2));
+  BOOST_CHECK_EQUAL(adjList.findAdjacent(103)->getName(), ndn::Name("/ndn/test").appendNumber(3));
+  BOOST_CHECK_EQUAL(adjList.findAdjacent(ndn::FaceUri("udp4://10.0.0.3:6363"))->getName(),
+                    ndn::Name("/ndn/test").appendNumber(3));
+}
+
 BOOST_AUTO_TEST_CASE(AdjLsaIsBuildableWithOneNodeActive)
 {
   Adjacent adjacencyA("/router/A");
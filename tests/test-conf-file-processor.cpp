@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California,
  *                           Arizona Board of Regents.
  *
@@ -42,6 +42,10 @@ const std::string SECTION_GENERAL =
   "  router-dead-interval 86400\n"
   "  sync-protocol psync\n"
   "  sync-interest-lifetime 10000\n"
+  "  signing-threads 2\n"
+  "  name-lsa-delta on\n"
+  "  name-lsa-shards 4\n"
+  "  name-lsa-compact on\n"
   "  state-dir /tmp\n"
   "}\n\n";
 
@@ -62,6 +66,9 @@ const std::string SECTION_NEIGHBORS =
   "  hello-timeout 1\n"
   "  hello-interval  60\n\n"
   "  adj-lsa-build-interval 10\n"
+  "  adj-lsa-throttle on\n"
+  "  adj-lsa-hold-down-min 200\n"
+  "  adj-lsa-hold-down-max 4000\n"
   "  neighbor\n"
   "  {\n"
   "    name /ndn/memphis.edu/cs/castor\n"
@@ -105,6 +112,15 @@ const std::string SECTION_FIB =
   "{\n"
   "   max-faces-per-prefix 3\n"
   "   routing-calc-interval 9\n"
+  "   spf-throttle on\n"
+  "   spf-initial-wait 10\n"
+  "   spf-backoff-wait 100\n"
+  "   spf-max-wait 2000\n"
+  "   routing-calc-background on\n"
+  "   spf-algorithm linear\n"
+  "   incremental-spf on\n"
+  "   spf-threads 4\n"
+  "   rib-command-window 16\n"
   "}\n\n";
 
 const std::string SECTION_ADVERTISING =
@@ -184,6 +200,10 @@ BOOST_AUTO_TEST_CASE(LinkState)
   BOOST_CHECK_EQUAL(conf.getLsaInterestLifetime(), ndn::time::seconds(3));
   BOOST_CHECK_EQUAL(conf.getRouterDeadInterval(), 86400);
   BOOST_CHECK_EQUAL(conf.getSyncInterestLifetime(), ndn::time::milliseconds(10000));
+  BOOST_CHECK_EQUAL(conf.getSigningThreads(), 2);
+  BOOST_CHECK(conf.isNameLsaDeltaEnabled());
+  BOOST_CHECK_EQUAL(conf.getNameLsaShards(), 4);
+  BOOST_CHECK(conf.isNameLsaCompactEnabled());
   BOOST_CHECK_EQUAL(conf.getStateFileDir(), "/tmp");
 
   // Neighbors
@@ -192,6 +212,9 @@ BOOST_AUTO_TEST_CASE(LinkState)
   BOOST_CHECK_EQUAL(conf.getInfoInterestInterval(), 60);
 
   BOOST_CHECK_EQUAL(conf.getAdjLsaBuildInterval(), 10);
+  BOOST_CHECK_EQUAL(conf.isAdjLsaThrottleEnabled(), true);
+  BOOST_CHECK_EQUAL(conf.getAdjLsaHoldDownMin(), 200_ms);
+  BOOST_CHECK_EQUAL(conf.getAdjLsaHoldDownMax(), 4000_ms);
 
   BOOST_CHECK(conf.getAdjacencyList().isNeighbor("/ndn/memphis.edu/cs/mira"));
   BOOST_CHECK(conf.getAdjacencyList().isNeighbor("/ndn/memphis.edu/cs/castor"));
@@ -213,6 +236,15 @@ BOOST_AUTO_TEST_CASE(LinkState)
   // FIB
   BOOST_CHECK_EQUAL(conf.getMaxFacesPerPrefix(), 3);
   BOOST_CHECK_EQUAL(conf.getRoutingCalcInterval(), 9);
+  BOOST_CHECK_EQUAL(conf.isSpfThrottleEnabled(), true);
+  BOOST_CHECK_EQUAL(conf.getSpfInitialWait(), 10_ms);
+  BOOST_CHECK_EQUAL(conf.getSpfBackoffWait(), 100_ms);
+  BOOST_CHECK_EQUAL(conf.getSpfMaxWait(), 2000_ms);
+  BOOST_CHECK_EQUAL(conf.isRoutingCalcInBackground(), true);
+  BOOST_CHECK(conf.getSpfAlgorithm() == SpfAlgorithm::LINEAR);
+  BOOST_CHECK_EQUAL(conf.isIncrementalSpfEnabled(), true);
+  BOOST_CHECK_EQUAL(conf.getSpfThreads(), 4);
+  BOOST_CHECK_EQUAL(conf.getRibCommandWindow(), 16);
 
   // Advertising
   BOOST_CHECK_EQUAL(conf.getNamePrefixList().size(), 2);
@@ -279,6 +311,10 @@ BOOST_AUTO_TEST_CASE(DefaultValuesGeneral)
   commentOut("lsa-refresh-time", config);
   commentOut("lsa-interest-lifetime", config);
   commentOut("router-dead-interval", config);
+  commentOut("signing-threads", config);
+  commentOut("name-lsa-delta", config);
+  commentOut("name-lsa-shards", config);
+  commentOut("name-lsa-compact", config);
 
   BOOST_REQUIRE(processConfigurationString(config));
 
@@ -286,6 +322,10 @@ BOOST_AUTO_TEST_CASE(DefaultValuesGeneral)
   BOOST_CHECK_EQUAL(conf.getLsaInterestLifetime(),
                     static_cast<ndn::time::seconds>(LSA_INTEREST_LIFETIME_DEFAULT));
   BOOST_CHECK_EQUAL(conf.getRouterDeadInterval(), (2 * conf.getLsaRefreshTime()));
+  BOOST_CHECK_EQUAL(conf.getSigningThreads(), SIGNING_THREADS_DEFAULT);
+  BOOST_CHECK(!conf.isNameLsaDeltaEnabled());
+  BOOST_CHECK_EQUAL(conf.getNameLsaShards(), NAME_LSA_SHARDS_DEFAULT);
+  BOOST_CHECK(!conf.isNameLsaCompactEnabled());
 
   BOOST_CHECK_NE(conf.m_confFileName, conf.getConfFileNameDynamic());
   conf.m_confFileName = "/tmp/nlsr.conf";
@@ -302,6 +342,9 @@ BOOST_AUTO_TEST_CASE(DefaultValuesNeighbors)
   commentOut("hello-interval", config);
   commentOut("first-hello-interval", config);
   commentOut("adj-lsa-build-interval", config);
+  commentOut("adj-lsa-throttle", config);
+  commentOut("adj-lsa-hold-down-min", config);
+  commentOut("adj-lsa-hold-down-max", config);
 
   BOOST_REQUIRE(processConfigurationString(config));
 
@@ -310,6 +353,11 @@ BOOST_AUTO_TEST_CASE(DefaultValuesNeighbors)
   BOOST_CHECK_EQUAL(conf.getInfoInterestInterval(), static_cast<uint32_t>(HELLO_INTERVAL_DEFAULT));
   BOOST_CHECK_EQUAL(conf.getAdjLsaBuildInterval(),
                     static_cast<uint32_t>(ADJ_LSA_BUILD_INTERVAL_DEFAULT));
+  BOOST_CHECK_EQUAL(conf.isAdjLsaThrottleEnabled(), false);
+  BOOST_CHECK_EQUAL(conf.getAdjLsaHoldDownMin(),
+                    ndn::time::milliseconds(ADJ_LSA_HOLD_DOWN_MIN_DEFAULT));
+  BOOST_CHECK_EQUAL(conf.getAdjLsaHoldDownMax(),
+                    ndn::time::milliseconds(ADJ_LSA_HOLD_DOWN_MAX_DEFAULT));
 }
 
 BOOST_AUTO_TEST_CASE(CanonizeNeighbors)
@@ -344,6 +392,15 @@ BOOST_AUTO_TEST_CASE(DefaultValuesFib)
 
   commentOut("max-faces-per-prefix", config);
   commentOut("routing-calc-interval", config);
+  commentOut("spf-throttle", config);
+  commentOut("spf-initial-wait", config);
+  commentOut("spf-backoff-wait", config);
+  commentOut("spf-max-wait", config);
+  commentOut("routing-calc-background", config);
+  commentOut("spf-algorithm", config);
+  commentOut("incremental-spf", config);
+  commentOut("spf-threads", config);
+  commentOut("rib-command-window", config);
 
   BOOST_REQUIRE(processConfigurationString(config));
 
@@ -351,6 +408,16 @@ BOOST_AUTO_TEST_CASE(DefaultValuesFib)
                     static_cast<uint32_t>(MAX_FACES_PER_PREFIX_DEFAULT));
   BOOST_CHECK_EQUAL(conf.getRoutingCalcInterval(),
                     static_cast<uint32_t>(ROUTING_CALC_INTERVAL_DEFAULT));
+  BOOST_CHECK_EQUAL(conf.isSpfThrottleEnabled(), false);
+  BOOST_CHECK_EQUAL(conf.getSpfInitialWait(), ndn::time::milliseconds(SPF_INITIAL_WAIT_DEFAULT));
+  BOOST_CHECK_EQUAL(conf.getSpfBackoffWait(), ndn::time::milliseconds(SPF_BACKOFF_WAIT_DEFAULT));
+  BOOST_CHECK_EQUAL(conf.getSpfMaxWait(), ndn::time::milliseconds(SPF_MAX_WAIT_DEFAULT));
+  BOOST_CHECK_EQUAL(conf.isRoutingCalcInBackground(), false);
+  BOOST_CHECK(conf.getSpfAlgorithm() == SpfAlgorithm::HEAP);
+  BOOST_CHECK_EQUAL(conf.isIncrementalSpfEnabled(), false);
+  BOOST_CHECK_EQUAL(conf.getSpfThreads(), static_cast<uint32_t>(SPF_THREADS_DEFAULT));
+  BOOST_CHECK_EQUAL(conf.getRibCommandWindow(),
+                    static_cast<uint32_t>(RIB_COMMAND_WINDOW_DEFAULT));
 }
 
 BOOST_AUTO_TEST_CASE(DefaultValuesHyperbolic)
@@ -377,6 +444,35 @@ BOOST_AUTO_TEST_CASE(OutOfRangeValue)
   BOOST_CHECK_EQUAL(processConfigurationString(SECTION_FIB_OUT_OF_RANGE), false);
 }
 
+BOOST_AUTO_TEST_CASE(SpfWaitLargerThanMaxWait)
+{
+  const std::string SECTION_FIB_SPF_WAIT =
+  "fib\n"
+  "{\n"
+  "   spf-throttle on\n"
+  "   spf-initial-wait 3000\n"
+  "   spf-max-wait 2000\n"
+  "}\n\n";
+
+  BOOST_CHECK_EQUAL(processConfigurationString(SECTION_FIB_SPF_WAIT), false);
+
+  // The waits are not checked when the throttle is off
+  std::string config = SECTION_FIB_SPF_WAIT;
+  boost::replace_first(config, "spf-throttle on", "spf-throttle off");
+  BOOST_CHECK_EQUAL(processConfigurationString(config), true);
+}
+
+BOOST_AUTO_TEST_CASE(AdjLsaHoldDownMinLargerThanMax)
+{
+  std::string config = SECTION_NEIGHBORS;
+  boost::replace_first(config, "adj-lsa-hold-down-min 200", "adj-lsa-hold-down-min 5000");
+  BOOST_CHECK_EQUAL(processConfigurationString(config), false);
+
+  // The hold-down is not checked when the throttle is off
+  boost::replace_first(config, "adj-lsa-throttle on", "adj-lsa-throttle off");
+  BOOST_CHECK_EQUAL(processConfigurationString(config), true);
+}
+
 BOOST_AUTO_TEST_CASE(NegativeValue)
 {
   const std::string SECTION_GENERAL_NEGATIVE_VALUE =
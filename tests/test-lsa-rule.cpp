@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California,
  *                           Arizona Board of Regents.
  *
@@ -126,6 +126,29 @@ BOOST_AUTO_TEST_CASE(ValidateCorrectLSA)
                                     });
 }
 
+BOOST_AUTO_TEST_CASE(ValidateNameLsaDelta)
+{
+  ndn::Name lsaDataName = confParam.getLsaPrefix();
+  lsaDataName.append(confParam.getSiteName());
+  lsaDataName.append(confParam.getRouterName());
+  lsaDataName.append(boost::lexical_cast<std::string>(Lsa::Type::NAME));
+  lsaDataName.appendNumber(lsdb.m_sequencingManager.getNameLsaSeq());
+
+  // Append the base sequence number of the delta, version, segmentNo
+  lsaDataName.append(Lsdb::DELTA_COMPONENT).appendNumber(1);
+  lsaDataName.appendNumber(1).appendNumber(1);
+
+  ndn::Data data(lsaDataName);
+  data.setFreshnessPeriod(10_s);
+  m_keyChain.sign(data, confParam.getSigningInfo());
+
+  confParam.getValidator().validate(data,
+                                    [] (const Data&) { BOOST_CHECK(true); },
+                                    [] (const Data&, const ndn::security::ValidationError& e) {
+                                      BOOST_ERROR(e);
+                                    });
+}
+
 BOOST_AUTO_TEST_CASE(DoNotValidateIncorrectLSA)
 {
   // getSubName removes the /localhop compnonent from /localhop/ndn/NLSR/LSA
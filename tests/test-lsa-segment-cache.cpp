@@ -0,0 +1,146 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "lsa-segment-cache.hpp"
+
+#include "tests/boost-test.hpp"
+#include "tests/test-common.hpp"
+
+#include <ndn-cxx/encoding/block-helpers.hpp>
+
+namespace nlsr::tests {
+
+static LsaSegmentCache::Segments
+makeSegments(const ndn::Name& versionedName, size_t nSegments, size_t payloadSize = 100)
+{
+  LsaSegmentCache::Segments segments;
+  std::vector<uint8_t> payload(payloadSize);
+  for (size_t i = 0; i < nSegments; ++i) {
+    auto data = makeData(ndn::Name(versionedName).appendSegment(i));
+    data->setContent(payload);
+    segments.push_back(signData(data));
+  }
+  return segments;
+}
+
+static size_t
+getNBytes(const LsaSegmentCache::Segments& segments)
+{
+  size_t nBytes = 0;
+  for (const auto& data : segments) {
+    nBytes += data->wireEncode().size();
+  }
+  return nBytes;
+}
+
+const ndn::Block WIRE1 = ndn::makeStringBlock(128, "wire1");
+const ndn::Block WIRE2 = ndn::makeStringBlock(128, "wire2");
+
+BOOST_AUTO_TEST_SUITE(TestLsaSegmentCache)
+
+BOOST_AUTO_TEST_CASE(InsertAndFind)
+{
+  LsaSegmentCache cache(100000);
+  ndn::Name name("/localhop/ndn/nlsr/LSA/site/router/NAME");
+  auto segments = makeSegments(ndn::Name(name).appendNumber(5).appendVersion(1), 3);
+
+  BOOST_CHECK(cache.insert(Lsa::Type::NAME, 0, 5, WIRE1, segments));
+  BOOST_CHECK_EQUAL(cache.size(), 1);
+  BOOST_CHECK_EQUAL(cache.getNBytes(), getNBytes(segments));
+
+  auto found = cache.find(Lsa::Type::NAME, 0, 5, WIRE1);
+  BOOST_REQUIRE(found != nullptr);
+  BOOST_CHECK(*found == segments);
+
+  // Another sequence number, type, or encoding is not found
+  BOOST_CHECK(cache.find(Lsa::Type::NAME, 0, 4, WIRE1) == nullptr);
+  BOOST_CHECK(cache.find(Lsa::Type::ADJACENCY, 0, 5, WIRE1) == nullptr);
+  BOOST_CHECK(cache.find(Lsa::Type::NAME, 0, 5, WIRE2) == nullptr);
+
+  // Segments are found by name only within their version
+  BOOST_CHECK_EQUAL(cache.findSegment(segments[2]->getName()), segments[2]);
+  BOOST_CHECK(cache.findSegment(ndn::Name(name).appendNumber(5).appendVersion(1)
+                                  .appendSegment(3)) == nullptr);
+  BOOST_CHECK(cache.findSegment(ndn::Name(name).appendNumber(5).appendVersion(2)
+                                  .appendSegment(0)) == nullptr);
+  BOOST_CHECK(cache.findSegment(ndn::Name(name).appendNumber(5)) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(ReplaceVersion)
+{
+  LsaSegmentCache cache(100000);
+  ndn::Name name("/localhop/ndn/nlsr/LSA/site/router/NAME");
+  auto segments5 = makeSegments(ndn::Name(name).appendNumber(5).appendVersion(1), 3);
+  auto segments6 = makeSegments(ndn::Name(name).appendNumber(6).appendVersion(2), 1);
+  auto adjSegments = makeSegments("/localhop/ndn/nlsr/LSA/site/router/ADJACENCY/1/v=1", 1);
+
+  cache.insert(Lsa::Type::NAME, 0, 5, WIRE1, segments5);
+  cache.insert(Lsa::Type::ADJACENCY, 0, 1, WIRE1, adjSegments);
+  cache.insert(Lsa::Type::NAME, 0, 6, WIRE2, segments6);
+
+  BOOST_CHECK_EQUAL(cache.size(), 2);
+  BOOST_CHECK_EQUAL(cache.getNBytes(), getNBytes(segments6) + getNBytes(adjSegments));
+  BOOST_CHECK(cache.find(Lsa::Type::NAME, 0, 5, WIRE1) == nullptr);
+  BOOST_CHECK(cache.findSegment(segments5[0]->getName()) == nullptr);
+  BOOST_CHECK(cache.find(Lsa::Type::NAME, 0, 6, WIRE2) != nullptr);
+
+  cache.erase(Lsa::Type::NAME, 0);
+  BOOST_CHECK_EQUAL(cache.size(), 1);
+  BOOST_CHECK_EQUAL(cache.getNBytes(), getNBytes(adjSegments));
+  BOOST_CHECK(cache.find(Lsa::Type::NAME, 0, 6, WIRE2) == nullptr);
+
+  // Each shard of a type has its own entry
+  auto shardSegments = makeSegments("/localhop/ndn/nlsr/LSA/site/router/NAME-1/1/v=1", 1);
+  cache.insert(Lsa::Type::NAME, 0, 6, WIRE2, segments6);
+  cache.insert(Lsa::Type::NAME, 1, 1, WIRE1, shardSegments);
+  BOOST_CHECK_EQUAL(cache.size(), 3);
+  cache.erase(Lsa::Type::NAME, 1);
+  BOOST_CHECK(cache.find(Lsa::Type::NAME, 1, 1, WIRE1) == nullptr);
+  BOOST_CHECK(cache.find(Lsa::Type::NAME, 0, 6, WIRE2) != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(Capacity)
+{
+  auto nameSegments = makeSegments("/localhop/ndn/nlsr/LSA/site/router/NAME/1/v=1", 2, 1000);
+  auto adjSegments = makeSegments("/localhop/ndn/nlsr/LSA/site/router/ADJACENCY/1/v=1", 2, 1000);
+  auto corSegments = makeSegments("/localhop/ndn/nlsr/LSA/site/router/COORDINATE/1/v=1", 1, 1000);
+
+  LsaSegmentCache cache(getNBytes(nameSegments) + getNBytes(adjSegments));
+  BOOST_CHECK(cache.insert(Lsa::Type::NAME, 0, 1, WIRE1, nameSegments));
+  BOOST_CHECK(cache.insert(Lsa::Type::ADJACENCY, 0, 1, WIRE1, adjSegments));
+  BOOST_CHECK_EQUAL(cache.size(), 2);
+
+  // The oldest entry is evicted to make room
+  BOOST_CHECK(cache.insert(Lsa::Type::COORDINATE, 0, 1, WIRE1, corSegments));
+  BOOST_CHECK_EQUAL(cache.size(), 2);
+  BOOST_CHECK(cache.find(Lsa::Type::NAME, 0, 1, WIRE1) == nullptr);
+  BOOST_CHECK(cache.find(Lsa::Type::ADJACENCY, 0, 1, WIRE1) != nullptr);
+  BOOST_CHECK_LE(cache.getNBytes(), cache.getCapacity());
+
+  // Segments larger than the whole cache are not cached
+  auto largeSegments = makeSegments("/localhop/ndn/nlsr/LSA/site/router/NAME/2/v=2", 5, 1000);
+  BOOST_CHECK(!cache.insert(Lsa::Type::NAME, 0, 2, WIRE1, largeSegments));
+  BOOST_CHECK(cache.find(Lsa::Type::NAME, 0, 2, WIRE1) == nullptr);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace nlsr::tests
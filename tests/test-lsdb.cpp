@@ -22,6 +22,7 @@
 #include "lsdb.hpp"
 #include "lsa/lsa.hpp"
 #include "name-prefix-list.hpp"
+#include "tlv-nlsr.hpp"
 
 #include "tests/io-key-chain-fixture.hpp"
 #include "tests/test-common.hpp"
@@ -281,6 +282,305 @@ BOOST_AUTO_TEST_CASE(ReceiveSegmentedLsaData)
   BOOST_CHECK_EQUAL(foundLsa->wireEncode(), lsa.wireEncode());
 }
 
+BOOST_AUTO_TEST_CASE(OwnLsaSegmentCache)
+{
+  ndn::Name originRouter("/ndn/site/%C1.Router/this-router");
+  auto lsa = lsdb.findLsa<NameLsa>(originRouter);
+  BOOST_REQUIRE(lsa != nullptr);
+
+  // Segments of own LSAs are produced when the LSA is installed
+  auto cached = lsdb.m_segmentCache.find(Lsa::Type::NAME, 0, lsa->getSeqNo(),
+                                         lsa->wireEncode());
+  BOOST_REQUIRE(cached != nullptr);
+  auto segment = cached->front();
+
+  ndn::Name interestName("/localhop/ndn/nlsr/LSA/site/%C1.Router/this-router/NAME");
+  interestName.appendNumber(lsa->getSeqNo());
+
+  face.sentData.clear();
+  lsdb.processInterest(ndn::Name(), ndn::Interest(interestName));
+  lsdb.processInterest(ndn::Name(), ndn::Interest(segment->getName()));
+  advanceClocks(10_ms);
+
+  // Both Interests are answered with the same signed segment
+  BOOST_REQUIRE_EQUAL(face.sentData.size(), 2);
+  BOOST_CHECK_EQUAL(face.sentData[0].wireEncode(), segment->wireEncode());
+  BOOST_CHECK_EQUAL(face.sentData[1].wireEncode(), segment->wireEncode());
+
+  // A new version of the LSA replaces the cached segments
+  lsdb.buildAndInstallOwnNameLsa();
+  auto newLsa = lsdb.findLsa<NameLsa>(originRouter);
+  BOOST_CHECK_EQUAL(lsdb.m_segmentCache.size(), 1);
+  BOOST_CHECK(lsdb.m_segmentCache.find(Lsa::Type::NAME, 0, newLsa->getSeqNo(),
+                                       newLsa->wireEncode()) != nullptr);
+  BOOST_CHECK(lsdb.m_segmentCache.findSegment(segment->getName()) == nullptr);
+
+  // The segments of an own LSA are removed along with it
+  lsdb.removeLsa(originRouter, Lsa::Type::NAME);
+  BOOST_CHECK_EQUAL(lsdb.m_segmentCache.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(NameLsaDeltaExchange)
+{
+  ndn::Name originRouter("/ndn/site/%C1.Router/this-router");
+  for (int i = 0; i < 5; ++i) {
+    conf.getNamePrefixList().insert(ndn::Name("/prefix").appendNumber(i));
+  }
+  lsdb.buildAndInstallOwnNameLsa();
+  auto base = *lsdb.findLsa<NameLsa>(originRouter);
+
+  conf.getNamePrefixList().insert("/prefix/a");
+  conf.getNamePrefixList().insert("/prefix/b");
+  lsdb.buildAndInstallOwnNameLsa();
+  conf.getNamePrefixList().erase("/prefix/a");
+  lsdb.buildAndInstallOwnNameLsa();
+  auto lsa = lsdb.findLsa<NameLsa>(originRouter);
+  BOOST_REQUIRE(!lsdb.m_ownNameLsaChanges[0].empty());
+  BOOST_CHECK_EQUAL(lsdb.m_ownNameLsaChanges[0].back().seqNo, lsa->getSeqNo());
+
+  ndn::Name lsaName("/localhop/ndn/nlsr/LSA/site/%C1.Router/this-router/NAME");
+  lsaName.appendNumber(lsa->getSeqNo());
+
+  // The changes since the base version are sent
+  face.sentData.clear();
+  lsdb.processInterest(ndn::Name(), ndn::Interest(ndn::Name(lsaName)
+                                                    .append(Lsdb::DELTA_COMPONENT)
+                                                    .appendNumber(base.getSeqNo())));
+  advanceClocks(10_ms);
+  BOOST_REQUIRE_EQUAL(face.sentData.size(), 1);
+  auto content = face.sentData[0].getContent().blockFromValue();
+  BOOST_REQUIRE_EQUAL(content.type(), nlsr::tlv::NameLsaDelta);
+
+  NameLsaDelta delta(content);
+  BOOST_CHECK_EQUAL(delta.getBaseSeqNo(), base.getSeqNo());
+  // A name added and withdrawn again since the base version is listed as withdrawn
+  BOOST_CHECK(delta.getAdded().getNpl().getNames() ==
+              std::list<ndn::Name>{ndn::Name("/prefix/b")});
+  BOOST_CHECK(delta.getRemoved() == std::list<ndn::Name>{ndn::Name("/prefix/a")});
+
+  // A router holding the base version installs the new version from the delta
+  ndn::Name router("/ndn/cs/%C1.Router/router1");
+  NameLsa otherBase(router, base.getSeqNo(), base.getExpirationTimePoint(), base.getNpl());
+  lsdb.installLsa(std::make_shared<NameLsa>(otherBase));
+  NameLsa otherAdded(router, lsa->getSeqNo(), lsa->getExpirationTimePoint(),
+                     delta.getAdded().getNpl());
+  NameLsaDelta otherDelta(base.getSeqNo(), otherAdded, delta.getRemoved());
+
+  ndn::Name otherName("/localhop/ndn/nlsr/LSA/cs/%C1.Router/router1/NAME");
+  otherName.appendNumber(lsa->getSeqNo());
+  lsdb.afterFetchLsa(otherDelta.wireEncode().getBuffer(), otherName);
+  auto installed = lsdb.findLsa<NameLsa>(router);
+  BOOST_REQUIRE(installed != nullptr);
+  BOOST_CHECK_EQUAL(installed->getSeqNo(), lsa->getSeqNo());
+  BOOST_CHECK_EQUAL(installed->getNpl(), lsa->getNpl());
+
+  // The whole LSA is sent if the changes since the base version are no longer known
+  face.sentData.clear();
+  lsdb.processInterest(ndn::Name(), ndn::Interest(ndn::Name(lsaName)
+                                                    .append(Lsdb::DELTA_COMPONENT)
+                                                    .appendNumber(base.getSeqNo() - 2)));
+  advanceClocks(10_ms);
+  BOOST_REQUIRE_EQUAL(face.sentData.size(), 1);
+  BOOST_CHECK_EQUAL(face.sentData[0].getContent().blockFromValue().type(), nlsr::tlv::NameLsa);
+}
+
+BOOST_AUTO_TEST_CASE(NameLsaShards)
+{
+  ndn::Name originRouter("/ndn/site/%C1.Router/this-router");
+  conf.setNameLsaShards(4);
+  for (int i = 0; i < 20; ++i) {
+    conf.getNamePrefixList().insert(ndn::Name("/prefix").appendNumber(i));
+  }
+  lsdb.buildAndInstallOwnNameLsa();
+
+  // Each prefix is in the shard selected by its hash
+  std::map<uint32_t, uint64_t> seqNos;
+  size_t nNames = 0;
+  for (uint32_t shard = 0; shard < 4; ++shard) {
+    auto lsa = lsdb.findLsa<NameLsa>(originRouter, shard);
+    BOOST_REQUIRE(lsa != nullptr);
+    BOOST_CHECK_EQUAL(lsa->getShard(), shard);
+    for (const auto& name : lsa->getNpl().getNames()) {
+      BOOST_CHECK_EQUAL(lsdb.getNameLsaShard(name), shard);
+    }
+    nNames += lsa->getNpl().size();
+    seqNos[shard] = lsa->getSeqNo();
+  }
+  BOOST_CHECK_EQUAL(nNames, conf.getNamePrefixList().size());
+
+  // A new prefix is originated in its own shard only
+  ndn::Name prefix("/prefix/new");
+  uint32_t prefixShard = lsdb.getNameLsaShard(prefix);
+  conf.getNamePrefixList().insert(prefix);
+  lsdb.buildAndInstallOwnNameLsa();
+  for (uint32_t shard = 0; shard < 4; ++shard) {
+    BOOST_CHECK_EQUAL(lsdb.findLsa<NameLsa>(originRouter, shard)->getSeqNo(),
+                      seqNos[shard] + (shard == prefixShard ? 1 : 0));
+  }
+
+  // Each shard is fetched under its own name
+  auto lsa = lsdb.findLsa<NameLsa>(originRouter, prefixShard);
+  ndn::Name interestName("/localhop/ndn/nlsr/LSA/site/%C1.Router/this-router");
+  interestName.append(makeLsaTypeComponent(Lsa::Type::NAME, prefixShard))
+              .appendNumber(lsa->getSeqNo());
+  face.sentData.clear();
+  lsdb.processInterest(ndn::Name(), ndn::Interest(interestName));
+  advanceClocks(10_ms);
+  BOOST_REQUIRE_EQUAL(face.sentData.size(), 1);
+  NameLsa fetched(face.sentData[0].getContent().blockFromValue());
+  BOOST_CHECK_EQUAL(fetched.getShard(), prefixShard);
+  BOOST_CHECK_EQUAL(fetched.getNpl(), lsa->getNpl());
+
+  // Shards of another router are installed separately, if their name matches their content
+  ndn::Name router("/ndn/cs/%C1.Router/router1");
+  NameLsa otherLsa(router, 5, ndn::time::system_clock::now() + 3600_s,
+                   NamePrefixList{ndn::Name("/cs/prefix")});
+  otherLsa.setShard(2);
+  ndn::Name otherName("/localhop/ndn/nlsr/LSA/cs/%C1.Router/router1");
+  otherName.append(makeLsaTypeComponent(Lsa::Type::NAME, 3)).appendNumber(5);
+  lsdb.afterFetchLsa(otherLsa.wireEncode().getBuffer(), otherName);
+  BOOST_CHECK(!lsdb.doesLsaExist(router, Lsa::Type::NAME, 3));
+  BOOST_CHECK(!lsdb.doesLsaExist(router, Lsa::Type::NAME, 2));
+
+  otherName = ndn::Name("/localhop/ndn/nlsr/LSA/cs/%C1.Router/router1");
+  otherName.append(makeLsaTypeComponent(Lsa::Type::NAME, 2)).appendNumber(5);
+  lsdb.afterFetchLsa(otherLsa.wireEncode().getBuffer(), otherName);
+  BOOST_CHECK(lsdb.doesLsaExist(router, Lsa::Type::NAME, 2));
+  BOOST_CHECK(!lsdb.doesLsaExist(router, Lsa::Type::NAME));
+
+  // Shards beyond a reduced shard count are withdrawn, and removed when they would be refreshed
+  conf.setNameLsaShards(2);
+  lsdb.buildAndInstallOwnNameLsa();
+  for (uint32_t shard = 2; shard < 4; ++shard) {
+    auto withdrawn = lsdb.findLsa<NameLsa>(originRouter, shard);
+    BOOST_REQUIRE(withdrawn != nullptr);
+    BOOST_CHECK_EQUAL(withdrawn->getNpl().size(), 0);
+    lsdb.expireOrRefreshLsa(withdrawn);
+    BOOST_CHECK(!lsdb.doesLsaExist(originRouter, Lsa::Type::NAME, shard));
+  }
+  BOOST_CHECK_EQUAL(lsdb.m_sequencingManager.getNameLsaShardSeqs().count(3), 0);
+  BOOST_CHECK_EQUAL(lsdb.findLsa<NameLsa>(originRouter, 0)->getNpl().size() +
+                    lsdb.findLsa<NameLsa>(originRouter, 1)->getNpl().size(),
+                    conf.getNamePrefixList().size());
+}
+
+BOOST_AUTO_TEST_CASE(CompactNameLsa)
+{
+  ndn::Name originRouter("/ndn/site/%C1.Router/this-router");
+  for (int i = 0; i < 300; ++i) {
+    conf.getNamePrefixList().insert(ndn::Name("/ndn/edu/ucla/cs/irl/testbed/hosts")
+                                      .appendNumber(i).append("video"));
+  }
+  lsdb.buildAndInstallOwnNameLsa();
+  auto lsa = lsdb.findLsa<NameLsa>(originRouter);
+  auto fullSegments = lsdb.m_segmentCache.find(Lsa::Type::NAME, 0, lsa->getSeqNo(),
+                                               lsa->wireEncode());
+  BOOST_REQUIRE(fullSegments != nullptr);
+  size_t nFullSegments = fullSegments->size();
+  BOOST_CHECK_GT(nFullSegments, 1);
+
+  // The compact encoding of the same prefixes needs fewer segments
+  conf.setNameLsaCompact(true);
+  lsdb.buildAndInstallOwnNameLsa();
+  lsa = lsdb.findLsa<NameLsa>(originRouter);
+  BOOST_CHECK(lsa->isCompact());
+  auto compactSegments = lsdb.m_segmentCache.find(Lsa::Type::NAME, 0, lsa->getSeqNo(),
+                                                  lsa->wireEncode());
+  BOOST_REQUIRE(compactSegments != nullptr);
+  BOOST_CHECK_LT(compactSegments->size(), nFullSegments);
+
+  ndn::Name interestName("/localhop/ndn/nlsr/LSA/site/%C1.Router/this-router/NAME");
+  interestName.appendNumber(lsa->getSeqNo());
+  face.sentData.clear();
+  lsdb.processInterest(ndn::Name(), ndn::Interest(interestName));
+  advanceClocks(10_ms);
+  BOOST_REQUIRE_EQUAL(face.sentData.size(), 1);
+  BOOST_CHECK_EQUAL(face.sentData[0].getName(), compactSegments->front()->getName());
+
+  // Another router installs a compact Name LSA like any other
+  ndn::Name router("/ndn/cs/%C1.Router/router1");
+  NameLsa otherLsa(router, 5, ndn::time::system_clock::now() + 3600_s, lsa->getNpl());
+  otherLsa.setCompact(true);
+  ndn::Name otherName("/localhop/ndn/nlsr/LSA/cs/%C1.Router/router1/NAME");
+  otherName.appendNumber(5);
+  lsdb.afterFetchLsa(otherLsa.wireEncode().getBuffer(), otherName);
+  auto installed = lsdb.findLsa<NameLsa>(router);
+  BOOST_REQUIRE(installed != nullptr);
+  BOOST_CHECK_EQUAL(installed->getNpl(), lsa->getNpl());
+}
+
+BOOST_AUTO_TEST_CASE(ReceiveRefreshedLsa)
+{
+  ndn::Name router("/ndn/cs/%C1.Router/router1");
+  NameLsa lsa(router, 5, ndn::time::system_clock::now() + 3600_s,
+              NamePrefixList{ndn::Name("/cs/a"), ndn::Name("/cs/b")});
+  ndn::Name lsaName("/localhop/ndn/nlsr/LSA/cs/%C1.Router/router1/NAME");
+  lsdb.afterFetchLsa(lsa.wireEncode().getBuffer(), ndn::Name(lsaName).appendNumber(5));
+  auto installed = lsdb.findLsa<NameLsa>(router);
+  BOOST_REQUIRE(installed != nullptr);
+
+  // A version that only differs in its sequence number and expiration time is installed
+  // without decoding its prefixes again
+  lsa.setSeqNo(6);
+  lsa.setExpirationTimePoint(ndn::time::system_clock::now() + 7200_s);
+  lsdb.afterFetchLsa(lsa.wireEncode().getBuffer(), ndn::Name(lsaName).appendNumber(6));
+  auto refreshed = lsdb.findLsa<NameLsa>(router);
+  BOOST_REQUIRE(refreshed != nullptr);
+  BOOST_CHECK_EQUAL(refreshed->getSeqNo(), 6);
+  BOOST_CHECK_EQUAL(refreshed->getExpirationTimePoint(), lsa.getExpirationTimePoint());
+  BOOST_CHECK_EQUAL(&refreshed->getNpl(), &installed->getNpl());
+
+  // A version with other prefixes is decoded
+  lsa.setSeqNo(7);
+  lsa.addName(PrefixInfo(ndn::Name("/cs/c"), 0));
+  lsdb.afterFetchLsa(lsa.wireEncode().getBuffer(), ndn::Name(lsaName).appendNumber(7));
+  auto updated = lsdb.findLsa<NameLsa>(router);
+  BOOST_CHECK_EQUAL(updated->getSeqNo(), 7);
+  BOOST_CHECK_EQUAL(updated->getNpl(), lsa.getNpl());
+  BOOST_CHECK_EQUAL(installed->getNpl().size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(AdjLsaThrottle)
+{
+  conf.setAdjLsaThrottle(true);
+  conf.setAdjLsaHoldDownMin(100);
+  conf.setAdjLsaHoldDownMax(400);
+  AdjacencyList& neighbors = conf.getAdjacencyList();
+  neighbors.insert(Adjacent("/ndn/neighborA", ndn::FaceUri("udp4://10.0.0.1"), 10,
+                            Adjacent::STATUS_ACTIVE, 0, 256));
+
+  auto getOwnAdjLsaSeqNo = [&] () -> uint64_t {
+    auto lsa = lsdb.findLsa<AdjLsa>(conf.getRouterPrefix());
+    return lsa != nullptr ? lsa->getSeqNo() : 0;
+  };
+
+  // The first change is originated at once
+  lsdb.scheduleAdjLsaBuild();
+  advanceClocks(1_ms);
+  uint64_t seqNo = getOwnAdjLsaSeqNo();
+  BOOST_CHECK_GT(seqNo, 0);
+
+  // A further change is held down
+  neighbors.insert(Adjacent("/ndn/neighborB", ndn::FaceUri("udp4://10.0.0.2"), 20,
+                            Adjacent::STATUS_ACTIVE, 0, 257));
+  lsdb.scheduleAdjLsaBuild();
+  advanceClocks(10_ms, 80_ms);
+  BOOST_CHECK_EQUAL(getOwnAdjLsaSeqNo(), seqNo);
+  advanceClocks(10_ms, 30_ms);
+  BOOST_CHECK_EQUAL(getOwnAdjLsaSeqNo(), seqNo + 1);
+
+  // The hold-down has doubled; a flap that restores the same adjacencies is not originated
+  neighbors.setStatusOfNeighbor("/ndn/neighborB", Adjacent::STATUS_INACTIVE);
+  lsdb.scheduleAdjLsaBuild();
+  neighbors.setStatusOfNeighbor("/ndn/neighborB", Adjacent::STATUS_ACTIVE);
+  lsdb.scheduleAdjLsaBuild();
+  advanceClocks(10_ms, 150_ms);
+  BOOST_CHECK(lsdb.getIsBuildAdjLsaScheduled());
+  advanceClocks(10_ms, 50_ms);
+  BOOST_CHECK(!lsdb.getIsBuildAdjLsaScheduled());
+  BOOST_CHECK_EQUAL(getOwnAdjLsaSeqNo(), seqNo + 1);
+}
+
 BOOST_AUTO_TEST_CASE(LsdbRemoveAndExists)
 {
   auto testTimePoint = ndn::time::system_clock::now();
@@ -326,9 +626,10 @@ BOOST_AUTO_TEST_CASE(InstallNameLsa)
   lsdb.installLsa(std::make_shared<NameLsa>(lsa));
 
   BOOST_REQUIRE_EQUAL(lsdb.doesLsaExist(otherRouter, Lsa::Type::NAME), true);
-  NamePrefixList& nameList = std::static_pointer_cast<NameLsa>(lsdb.findLsa(otherRouter, Lsa::Type::NAME))->getNpl();
+  // Updates replace the installed LSA, so it has to be looked up again after each update
+  auto nameList = [&] { return lsdb.findLsa<NameLsa>(otherRouter)->getNpl(); };
 
-  BOOST_CHECK_EQUAL(nameList, prefixes);
+  BOOST_CHECK_EQUAL(nameList(), prefixes);
 
   // Add a prefix: name3
   ndn::Name name3("/ndn/name3");
@@ -338,7 +639,7 @@ BOOST_AUTO_TEST_CASE(InstallNameLsa)
   lsdb.installLsa(std::make_shared<NameLsa>(addLsa));
 
   // Lsa should include name1, name2, and name3
-  BOOST_CHECK_EQUAL(nameList, prefixes);
+  BOOST_CHECK_EQUAL(nameList(), prefixes);
 
   // Remove a prefix: name2
   prefixes.erase(name2);
@@ -347,7 +648,7 @@ BOOST_AUTO_TEST_CASE(InstallNameLsa)
   lsdb.installLsa(std::make_shared<NameLsa>(removeLsa));
 
   // Lsa should include name1 and name3
-  BOOST_CHECK_EQUAL(nameList, prefixes);
+  BOOST_CHECK_EQUAL(nameList(), prefixes);
 
   // Add and remove a prefix: add name2, remove name3
   prefixes.insert(name2);
@@ -357,7 +658,7 @@ BOOST_AUTO_TEST_CASE(InstallNameLsa)
   lsdb.installLsa(std::make_shared<NameLsa>(addAndRemoveLsa));
 
   // Lsa should include name1 and name2
-  BOOST_CHECK_EQUAL(nameList, prefixes);
+  BOOST_CHECK_EQUAL(nameList(), prefixes);
 
   // Install a completely new list of prefixes
   ndn::Name name4("/ndn/name4");
@@ -371,7 +672,51 @@ BOOST_AUTO_TEST_CASE(InstallNameLsa)
   lsdb.installLsa(std::make_shared<NameLsa>(newLsa));
 
   // Lsa should include name4 and name5
-  BOOST_CHECK_EQUAL(nameList, newPrefixes);
+  BOOST_CHECK_EQUAL(nameList(), newPrefixes);
+}
+
+BOOST_AUTO_TEST_CASE(Snapshot)
+{
+  ndn::Name otherRouter("/ndn/site/%C1.router/other-router");
+  const auto MAX_TIME = ndn::time::system_clock::time_point::max();
+
+  NamePrefixList prefixes;
+  prefixes.insert("/ndn/name1");
+  lsdb.installLsa(std::make_shared<NameLsa>(otherRouter, 1, MAX_TIME, prefixes));
+
+  auto snapshot1 = lsdb.getSnapshot();
+  BOOST_CHECK_EQUAL(lsdb.getSnapshot(), snapshot1);
+  auto nameLsa1 = snapshot1->findLsa<NameLsa>(otherRouter);
+  BOOST_REQUIRE(nameLsa1 != nullptr);
+  BOOST_CHECK_EQUAL(nameLsa1->getNpl(), prefixes);
+
+  // Updating the LSA does not affect the earlier snapshot
+  NamePrefixList newPrefixes(prefixes);
+  newPrefixes.insert("/ndn/name2");
+  lsdb.installLsa(std::make_shared<NameLsa>(otherRouter, 2, MAX_TIME, newPrefixes));
+
+  auto snapshot2 = lsdb.getSnapshot();
+  BOOST_CHECK_NE(snapshot2, snapshot1);
+  BOOST_CHECK_GT(snapshot2->getVersion(), snapshot1->getVersion());
+  BOOST_CHECK_EQUAL(snapshot1->findLsa<NameLsa>(otherRouter)->getSeqNo(), 1);
+  BOOST_CHECK_EQUAL(snapshot1->findLsa<NameLsa>(otherRouter)->getNpl(), prefixes);
+  BOOST_CHECK_EQUAL(snapshot2->findLsa<NameLsa>(otherRouter)->getSeqNo(), 2);
+  BOOST_CHECK_EQUAL(snapshot2->findLsa<NameLsa>(otherRouter)->getNpl(), newPrefixes);
+
+  // LSAs of unchanged types are shared between snapshots
+  AdjacencyList adjacencies;
+  AdjLsa adjLsa(otherRouter, 1, MAX_TIME, adjacencies);
+  lsdb.installLsa(std::make_shared<AdjLsa>(adjLsa));
+  auto snapshot3 = lsdb.getSnapshot();
+  BOOST_CHECK_EQUAL(snapshot3->findLsa<NameLsa>(otherRouter),
+                    snapshot2->findLsa<NameLsa>(otherRouter));
+  BOOST_CHECK(snapshot2->findLsa<AdjLsa>(otherRouter) == nullptr);
+  BOOST_CHECK(snapshot3->findLsa<AdjLsa>(otherRouter) != nullptr);
+
+  // Removing the LSA does not affect earlier snapshots
+  lsdb.removeLsa(otherRouter, Lsa::Type::NAME);
+  BOOST_CHECK(lsdb.getSnapshot()->findLsa<NameLsa>(otherRouter) == nullptr);
+  BOOST_CHECK(snapshot3->findLsa<NameLsa>(otherRouter) != nullptr);
 }
 
 BOOST_AUTO_TEST_CASE(TestIsLsaNew)
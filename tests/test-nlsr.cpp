@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California,
  *                           Arizona Board of Regents.
  *
@@ -451,7 +451,7 @@ BOOST_AUTO_TEST_CASE(BuildAdjLsaAfterHelloResponse)
   receiveHelloData(neighborBName, conf.getRouterPrefix());
 
   // Both routers become INACTIVE and HELLO Interests have timed out
-  for (Adjacent& adjacency : neighbors.getAdjList()) {
+  for (Adjacent& adjacency : neighbors) {
     adjacency.setStatus(Adjacent::STATUS_INACTIVE);
     adjacency.setInterestTimedOutNo(HELLO_RETRIES_DEFAULT);
   }
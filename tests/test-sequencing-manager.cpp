@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  The University of Memphis,
+ * Copyright (c) 2014-2026,  The University of Memphis,
  *                           Regents of the University of California,
  *                           Arizona Board of Regents.
  *
@@ -89,6 +89,28 @@ BOOST_AUTO_TEST_CASE(SeparateSeqNumber)
   checkSeqNumbers(100 + 10, 0, 100 + 10);
 }
 
+BOOST_AUTO_TEST_CASE(NameLsaShards)
+{
+  writeToFile("NameLsaSeq 100\nAdjLsaSeq 100\nCorLsaSeq 0\nNameLsaShardSeq 2 50");
+  initiateFromFile();
+  checkSeqNumbers(100 + 10, 100 + 10, 0);
+  BOOST_CHECK_EQUAL(m_seqManager.getNameLsaSeq(2), 50 + 10);
+  BOOST_CHECK_EQUAL(m_seqManager.getNameLsaSeq(3), 0);
+
+  m_seqManager.increaseNameLsaSeq(3);
+  BOOST_CHECK_EQUAL(m_seqManager.getLsaSeq(Lsa::Type::NAME, 3), 1);
+  m_seqManager.writeSeqNoToFile();
+
+  initiateFromFile();
+  BOOST_CHECK_EQUAL(m_seqManager.getNameLsaSeq(2), 50 + 10 + 10);
+  BOOST_CHECK_EQUAL(m_seqManager.getNameLsaSeq(3), 1 + 10);
+
+  m_seqManager.eraseNameLsaShard(2);
+  m_seqManager.writeSeqNoToFile();
+  initiateFromFile();
+  BOOST_CHECK_EQUAL(m_seqManager.getNameLsaShardSeqs().size(), 1);
+}
+
 BOOST_AUTO_TEST_CASE(CorruptFile)
 {
   writeToFile("NameLsaSeq");
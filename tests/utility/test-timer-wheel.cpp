@@ -0,0 +1,133 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "utility/timer-wheel.hpp"
+
+#include "tests/boost-test.hpp"
+#include "tests/io-fixture.hpp"
+
+#include <vector>
+
+namespace nlsr::tests {
+
+using util::TimerWheel;
+
+class TimerWheelFixture : public IoFixture
+{
+public:
+  ndn::Scheduler scheduler{m_io};
+  // A revolution of 10 seconds, so that some timers are scheduled beyond it
+  TimerWheel wheel{scheduler, 1_s, 10};
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestTimerWheel, TimerWheelFixture)
+
+BOOST_AUTO_TEST_CASE(Expire)
+{
+  std::vector<int> fired;
+  wheel.schedule(3_s, [&] { fired.push_back(3); });
+  wheel.schedule(1_s, [&] { fired.push_back(1); });
+  wheel.schedule(25_s, [&] { fired.push_back(25); });
+  wheel.schedule(13_s, [&] { fired.push_back(13); });
+  BOOST_CHECK_EQUAL(wheel.size(), 4);
+
+  advanceClocks(100_ms, 9);
+  BOOST_CHECK(fired.empty());
+
+  advanceClocks(100_ms, 22);
+  BOOST_CHECK(fired == (std::vector<int>{1, 3}));
+
+  // 13 seconds is in the same slot as 3 seconds, one revolution later
+  advanceClocks(1_s, 11);
+  BOOST_CHECK(fired == (std::vector<int>{1, 3, 13}));
+
+  advanceClocks(1_s, 12);
+  BOOST_CHECK(fired == (std::vector<int>{1, 3, 13, 25}));
+  BOOST_CHECK_EQUAL(wheel.size(), 0);
+  BOOST_CHECK_EQUAL(wheel.getNExpired(), 4);
+}
+
+BOOST_AUTO_TEST_CASE(NeverEarly)
+{
+  advanceClocks(700_ms);
+
+  bool hasFired = false;
+  wheel.schedule(1_s, [&] { hasFired = true; });
+
+  // The deadline falls between two ticks; the timer expires at the later one
+  advanceClocks(100_ms, 9);
+  BOOST_CHECK(!hasFired);
+  advanceClocks(100_ms, 5);
+  BOOST_CHECK(hasFired);
+}
+
+BOOST_AUTO_TEST_CASE(Cancel)
+{
+  int nFired = 0;
+  auto id1 = wheel.schedule(2_s, [&] { ++nFired; });
+  auto id2 = wheel.schedule(2_s, [&] { ++nFired; });
+  TimerWheel::EventId id3;
+  wheel.schedule(2_s, [&] { ++nFired; wheel.cancel(id3); });
+  id3 = wheel.schedule(2_s, [&] { ++nFired; });
+
+  BOOST_CHECK(wheel.isPending(id1));
+  wheel.cancel(id1);
+  BOOST_CHECK(!wheel.isPending(id1));
+  BOOST_CHECK(wheel.isPending(id2));
+
+  // Cancelling twice, or a default-constructed EventId, has no effect
+  wheel.cancel(id1);
+  wheel.cancel(TimerWheel::EventId());
+  BOOST_CHECK_EQUAL(wheel.getNCancelled(), 1);
+  BOOST_CHECK_EQUAL(wheel.size(), 3);
+
+  advanceClocks(1_s, 3);
+  // Timers of the same tick expire in the order they were scheduled, so id3 is cancelled
+  // by the callback of a timer that expired before it on the same tick
+  BOOST_CHECK_EQUAL(nFired, 2);
+  BOOST_CHECK(!wheel.isPending(id3));
+  BOOST_CHECK(!wheel.isPending(id2));
+  BOOST_CHECK_EQUAL(wheel.size(), 0);
+
+  // Reusing the storage of cancelled and expired timers does not revive their EventIds
+  auto id4 = wheel.schedule(1_s, [] {});
+  BOOST_CHECK(wheel.isPending(id4));
+  BOOST_CHECK(!wheel.isPending(id1));
+}
+
+BOOST_AUTO_TEST_CASE(ScheduleFromCallback)
+{
+  int nFired = 0;
+  std::function<void()> reschedule = [&] {
+    if (++nFired < 3) {
+      wheel.schedule(5_s, reschedule);
+    }
+  };
+  wheel.schedule(5_s, reschedule);
+
+  advanceClocks(1_s, 16);
+  BOOST_CHECK_EQUAL(nFired, 3);
+  BOOST_CHECK_EQUAL(wheel.size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace nlsr::tests